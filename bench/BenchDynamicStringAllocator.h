@@ -0,0 +1,96 @@
+#pragma once
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringAllocator.h"
+
+/// @brief Runs the churn on the specified number of threads and returns
+/// the number of millions of allocations per second.
+template <typename Churn>
+double MeasureAllocationRate(unsigned threadCount, size_t operations, Churn churn)
+{
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < threadCount; t++)
+        threads.emplace_back([&churn, t, operations]() { churn(t, operations); });
+    for (std::thread& thread : threads)
+        thread.join();
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return threadCount * operations / elapsed.count() / 1e6;
+}
+
+/// @brief Measures allocations per second under multi-threaded churn: every
+/// thread keeps a window of live blocks of random small sizes and keeps
+/// replacing random ones of them, comparing the pooled allocator with the
+/// global heap. Strings grown character by character are measured too.
+inline void BenchDynamicStringAllocator()
+{
+    const size_t operations = 2000000;
+    const size_t window = 1024;
+
+    auto pooled = [window](unsigned seed, size_t count) {
+        std::mt19937 random(seed);
+        std::vector<std::pair<char*, size_t>> live(window, std::make_pair(nullptr, size_t(0)));
+        for (size_t i = 0; i < count; i++)
+        {
+            std::pair<char*, size_t>& slot = live[random() % window];
+            DynamicStringAllocator::Deallocate(slot.first, slot.second);
+            slot.second = 1 + random() % 256;
+            slot.first = DynamicStringAllocator::Allocate(slot.second);
+            slot.first[0] = 'x';
+        }
+        for (std::pair<char*, size_t>& slot : live)
+            DynamicStringAllocator::Deallocate(slot.first, slot.second);
+    };
+
+    auto heap = [window](unsigned seed, size_t count) {
+        std::mt19937 random(seed);
+        std::vector<char*> live(window, nullptr);
+        for (size_t i = 0; i < count; i++)
+        {
+            char*& slot = live[random() % window];
+            delete[] slot;
+            slot = new char[1 + random() % 256];
+            slot[0] = 'x';
+        }
+        for (char* slot : live)
+            delete[] slot;
+    };
+
+    auto strings = [window](unsigned seed, size_t count) {
+        std::mt19937 random(seed);
+        std::vector<DynamicString> live(window);
+        // every string grows from the default capacity one character at a time
+        for (size_t i = 0; i < count / 8; i++)
+        {
+            DynamicString string;
+            for (size_t length = random() % 64; length > 0; length--)
+                string.Add('x');
+            live[random() % window] = std::move(string);
+        }
+    };
+
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+    {
+        double pooledRate = MeasureAllocationRate(threadCount, operations, pooled);
+        double heapRate = MeasureAllocationRate(threadCount, operations, heap);
+        double stringRate = MeasureAllocationRate(threadCount, operations / 8, strings);
+
+        std::cout << std::setw(4) << threadCount << " threads: "
+            << std::fixed << std::setprecision(2)
+            << pooledRate << " M allocations/s pooled, "
+            << heapRate << " M allocations/s from the heap, "
+            << stringRate << " M grown strings/s" << std::endl;
+
+        if (threadCount < maxThreads && threadCount * 2 > maxThreads)
+            threadCount = maxThreads / 2;
+    }
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringBuilder.h"
+#include "DynamicStringInterner.h"
+
+/// @brief Measures how interning throughput scales with the number of threads.
+/// Every thread interns the same set of keys, starting at a different offset,
+/// so both inserts of new keys and lookups of existing ones race with each other.
+inline void BenchDynamicStringInterner()
+{
+    const size_t keyCount = 200000;
+    const size_t distinctCount = 50000;
+    const size_t rounds = 10;
+
+    std::vector<DynamicString> keys;
+    keys.reserve(keyCount);
+    for (size_t i = 0; i < keyCount; i++)
+    {
+        DynamicStringBuilder builder;
+        builder.Append("ingest/key/").Append(i % distinctCount);
+        keys.push_back(builder.Build());
+    }
+
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    double singleThreadRate = 0;
+
+    for (unsigned threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+    {
+        DynamicStringInterner interner(distinctCount);
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < threadCount; t++)
+            threads.emplace_back([&, t]() {
+                size_t offset = t * keyCount / threadCount;
+                for (size_t round = 0; round < rounds; round++)
+                    for (size_t i = 0; i < keyCount; i++)
+                        interner.Intern(keys[(offset + i) % keyCount]);
+            });
+        for (std::thread& thread : threads)
+            thread.join();
+
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        double rate = threadCount * rounds * keyCount / elapsed.count() / 1e6;
+        if (threadCount == 1)
+            singleThreadRate = rate;
+
+        std::cout << std::setw(4) << threadCount << " threads: "
+            << std::fixed << std::setprecision(2) << rate << " M interns/s, "
+            << rate / singleThreadRate << "x, "
+            << interner.Size() << " distinct" << std::endl;
+
+        if (threadCount < maxThreads && threadCount * 2 > maxThreads)
+            threadCount = maxThreads / 2;
+    }
+}
@@ -0,0 +1,29 @@
+#include <cstring>
+#include <iostream>
+
+#include "BenchDynamicStringAllocator.h"
+#include "BenchDynamicStringInterner.h"
+
+struct Benchmark
+{
+    const char* name;
+    void (*run)();
+};
+
+int main(int argc, char** argv)
+{
+    const Benchmark benchmarks[] = {
+        { "Interner", BenchDynamicStringInterner },
+        { "Allocator", BenchDynamicStringAllocator },
+    };
+
+    // runs the benchmarks whose names contain the first argument, or all of them
+    const char* filter = argc > 1 ? argv[1] : "";
+    for (const Benchmark& benchmark : benchmarks)
+    {
+        if (!strstr(benchmark.name, filter)) continue;
+
+        std::cout << "[" << benchmark.name << "]" << std::endl;
+        benchmark.run();
+    }
+}
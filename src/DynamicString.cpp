@@ -1,4 +1,8 @@
 #include "DynamicString.h"
+#include "DynamicStringAllocator.h"
+#include "DynamicStringSearcher.h"
+
+constexpr size_t DynamicString::NOT_FOUND;
 
 DynamicString::DynamicString() : DynamicString("") { }
 
@@ -7,9 +11,10 @@ DynamicString::DynamicString(size_t capacity)
     Reserve(capacity);
 }
 
-DynamicString::DynamicString(const char* value)
+DynamicString::DynamicString(const char* value, size_t length)
 {
-    SetCharacters(value);
+    Reserve(length);
+    Concatenate(value, length);
 }
 
 DynamicString::DynamicString(const DynamicString& other)
@@ -24,7 +29,7 @@ DynamicString::DynamicString(DynamicString&& other) noexcept
 
 DynamicString::~DynamicString()
 {
-    delete[] characters;
+    DynamicStringAllocator::Deallocate(characters, capacity + 1);
 }
 
 void DynamicString::Add(char character)
@@ -41,13 +46,20 @@ void DynamicString::Concatenate(const char* value)
 {
     if (!value) return;
 
-    size_t valueLength = strlen(value);
+    Concatenate(value, strlen(value));
+}
+
+void DynamicString::Concatenate(const char* value, size_t valueLength)
+{
+    if (!value) return;
+
     size_t newLength = length + valueLength;
-    if (newLength > capacity)
+    if (newLength > capacity || !characters)
         // Reallocate(newLength + newLength % 2);
         Reallocate(newLength);
 
-    memcpy(characters + length, value, (valueLength + 1) * sizeof(char));
+    memcpy(characters + length, value, valueLength * sizeof(char));
+    characters[newLength] = '\0';
     length = newLength;
 }
 
@@ -56,10 +68,19 @@ void DynamicString::Remove(size_t index)
     assert(index < length);
     assert(characters != nullptr);
 
-    memcpy(characters + index, characters + index + 1, (length - index + 1) * sizeof(char));
+    memmove(characters + index, characters + index + 1, (length - index) * sizeof(char));
     length--;
 }
 
+void DynamicString::Truncate(size_t newLength)
+{
+    assert(newLength <= length);
+    if (!characters) return;
+
+    characters[newLength] = '\0';
+    length = newLength;
+}
+
 void DynamicString::Insert(size_t index, char character)
 {
     assert(index < length);
@@ -78,6 +99,165 @@ void DynamicString::Insert(size_t index, char character)
     length++;
 }
 
+void DynamicString::ToLower()
+{
+    DynamicStringTransform::ToLower(characters, length, characters);
+}
+
+void DynamicString::ToUpper()
+{
+    DynamicStringTransform::ToUpper(characters, length, characters);
+}
+
+void DynamicString::Trim()
+{
+    TrimRight();
+    TrimLeft();
+}
+
+void DynamicString::TrimLeft()
+{
+    if (!characters) return;
+
+    size_t skipped = DynamicStringTransform::CountLeadingWhitespace(characters, length);
+    if (skipped == 0) return;
+
+    // moving the null-terminating character as well
+    memmove(characters, characters + skipped, (length - skipped + 1) * sizeof(char));
+    length -= skipped;
+}
+
+void DynamicString::TrimRight()
+{
+    if (!characters) return;
+
+    Truncate(length - DynamicStringTransform::CountTrailingWhitespace(characters, length));
+}
+
+DynamicString DynamicString::ToLowerCopy() const
+{
+    DynamicString copy(length);
+    DynamicStringTransform::ToLower(characters, length, copy.characters);
+    copy.characters[length] = '\0';
+    copy.length = length;
+    return copy;
+}
+
+DynamicString DynamicString::ToUpperCopy() const
+{
+    DynamicString copy(length);
+    DynamicStringTransform::ToUpper(characters, length, copy.characters);
+    copy.characters[length] = '\0';
+    copy.length = length;
+    return copy;
+}
+
+size_t DynamicString::ReplaceAll(char from, char to)
+{
+    if (!characters) return 0;
+
+    size_t count = 0;
+    char* end = characters + length;
+    char* current = characters;
+    while ((current = static_cast<char*>(memchr(current, from, end - current))))
+    {
+        *current++ = to;
+        count++;
+    }
+    return count;
+}
+
+size_t DynamicString::ReplaceAll(DynamicStringView from, DynamicStringView to)
+{
+    if (!characters || from.IsEmpty()) return 0;
+
+    // the patterns are copied if they view the characters being rewritten
+    const char* end = characters + length;
+    if ((from.Characters() >= characters && from.Characters() < end) ||
+        (to.Characters() >= characters && to.Characters() < end))
+    {
+        DynamicString fromCopy(from), toCopy(to);
+        return ReplaceAll(fromCopy, toCopy);
+    }
+
+    size_t fromLength = from.Length();
+    size_t toLength = to.Length();
+    // the pattern is compiled once and reused for every match
+    DynamicStringSearcher searcher(from);
+    DynamicStringView source = *this;
+
+    if (toLength <= fromLength)
+    {
+        // the result is not longer, so it is compacted in place:
+        // the write position never overtakes the read position
+        size_t count = 0;
+        const char* read = characters;
+        char* write = characters;
+        size_t index;
+        while ((index = searcher.Find(source, read - characters)) != NOT_FOUND)
+        {
+            const char* found = characters + index;
+            size_t gap = found - read;
+            memmove(write, read, gap * sizeof(char));
+            write += gap;
+            memcpy(write, to.Characters(), toLength * sizeof(char));
+            write += toLength;
+            read = found + fromLength;
+            count++;
+        }
+        if (count == 0) return 0;
+
+        size_t tail = end - read;
+        memmove(write, read, tail * sizeof(char));
+        write += tail;
+        *write = '\0';
+        length = write - characters;
+        return count;
+    }
+
+    // the first pass only counts the matches to size the result exactly
+    size_t count = 0;
+    for (size_t index = 0; (index = searcher.Find(source, index)) != NOT_FOUND; index += fromLength)
+        count++;
+    if (count == 0) return 0;
+
+    size_t newLength = length + count * (toLength - fromLength);
+    size_t newCapacity = newLength > capacity ? newLength : capacity;
+    char* newCharacters = DynamicStringAllocator::Allocate(newCapacity + 1);
+
+    const char* read = characters;
+    char* write = newCharacters;
+    size_t index;
+    while ((index = searcher.Find(source, read - characters)) != NOT_FOUND)
+    {
+        const char* found = characters + index;
+        size_t gap = found - read;
+        memcpy(write, read, gap * sizeof(char));
+        write += gap;
+        memcpy(write, to.Characters(), toLength * sizeof(char));
+        write += toLength;
+        read = found + fromLength;
+    }
+    memcpy(write, read, (end - read) * sizeof(char));
+    newCharacters[newLength] = '\0';
+
+    DynamicStringAllocator::Deallocate(characters, capacity + 1);
+    characters = newCharacters;
+    length = newLength;
+    capacity = newCapacity;
+    return count;
+}
+
+size_t DynamicString::Find(DynamicStringView pattern, size_t offset) const
+{
+    return DynamicStringSearcher::Find(*this, pattern, offset);
+}
+
+size_t DynamicString::FindCaseInsensitive(DynamicStringView pattern, size_t offset) const
+{
+    return DynamicStringSearcher(pattern, true).Find(*this, offset);
+}
+
 size_t DynamicString::Reserve(size_t newCapacity)
 {
     if (capacity == 0 && newCapacity == 0)
@@ -88,15 +268,32 @@ size_t DynamicString::Reserve(size_t newCapacity)
     return capacity;
 }
 
+void DynamicString::ShrinkToFit()
+{
+    if (!characters) return;
+
+    size_t newCapacity = length > 0 ? length : DEFAULT_CAPACITY;
+    if (newCapacity < capacity)
+        Reallocate(newCapacity);
+}
+
 void DynamicString::Clear()
 {
     // we do not modify the capacity after calling the clear
-    SetCharacters("");
+    SetCharacters("", capacity);
 }
 
 bool DynamicString::Equals(const char* otherCharacters) const
 {
-    return strcmp(characters, otherCharacters) == 0;
+    if (!otherCharacters) return length == 0;
+
+    // the other characters are read up to the first difference only,
+    // so they are never counted to their end; their end is a difference too,
+    // even if this string has a null character there
+    for (size_t i = 0; i < length; i++)
+        if (otherCharacters[i] != characters[i] || otherCharacters[i] == '\0')
+            return false;
+    return otherCharacters[length] == '\0';
 }
 
 const char& DynamicString::operator[](size_t index) const
@@ -113,17 +310,14 @@ char& DynamicString::operator[](size_t index)
 
 DynamicString& DynamicString::operator=(const char* newValue)
 {
-    SetCharacters(newValue);
+    SetCharacters(newValue, capacity);
     return *this;
 }
 
 DynamicString& DynamicString::operator=(const DynamicString& other)
 {
     if (this != &other)
-    {
-        delete[] characters;
         DeepCopyFrom(other);
-    }
 
     return *this;
 }
@@ -132,7 +326,7 @@ DynamicString& DynamicString::operator=(DynamicString&& other) noexcept
 {
     if (this != &other)
     {
-        delete[] characters;    
+        DynamicStringAllocator::Deallocate(characters, capacity + 1);
         ShallowCopyFrom(std::move(other));
     }
 
@@ -144,30 +338,38 @@ bool DynamicString::operator==(const DynamicString& other) const
     return Equals(other);
 }
 
-void DynamicString::SetCharacters(const char* value)
+void DynamicString::SetCharacters(const char* value, size_t minimumCapacity)
 {
     if (!value)
     {
+        DynamicStringAllocator::Deallocate(characters, capacity + 1);
+        // without characters there is no capacity either,
+        // so the next change of the string allocates them
         characters = nullptr;
         length = 0;
+        capacity = 0;
         return;
     }
 
-    length = strlen(value);
-    char* newCharacters = new char[length + 1];
-    
-    memcpy(newCharacters, value, (length + 1) * sizeof(char));
-    characters = newCharacters;
+    size_t newLength = strlen(value);
+    size_t newCapacity = minimumCapacity > 0 ? minimumCapacity : DEFAULT_CAPACITY;
+    newCapacity = newCapacity < newLength ? newLength : newCapacity;
+
+    // the value may point into the current characters,
+    // so they are released only after being copied
+    char* newCharacters = DynamicStringAllocator::Allocate(newCapacity + 1);
+    memcpy(newCharacters, value, (newLength + 1) * sizeof(char));
+    DynamicStringAllocator::Deallocate(characters, capacity + 1);
 
-    capacity = capacity > 0 ? capacity : DEFAULT_CAPACITY;
-    capacity = capacity < length ? length : capacity;
+    characters = newCharacters;
+    length = newLength;
+    capacity = newCapacity;
 }
 
 void DynamicString::DeepCopyFrom(const DynamicString& other)
 {
-    SetCharacters(other.characters);
-    length = other.length;
-    capacity = other.capacity;
+    // the copy keeps the capacity of the original string
+    SetCharacters(other.characters, other.capacity);
 }
 
 void DynamicString::ShallowCopyFrom(DynamicString&& other)
@@ -188,17 +390,20 @@ void DynamicString::Reallocate(size_t newCapacity)
     if (newCapacity == 0)
         newCapacity = DEFAULT_CAPACITY;
 
-    char* newCharacters = new char[newCapacity + 1];
-    
-    if (characters)
-        memcpy(newCharacters, characters, (length + 1) * sizeof(char));
-    else
+    if (!characters)
+    {
         // setting a null-terminating character at the start 
         // to create an empty string ""
-        newCharacters[0] = '\0';
-    delete[] characters;
-    
-    characters = newCharacters;
+        characters = DynamicStringAllocator::Allocate(newCapacity + 1);
+        characters[0] = '\0';
+        capacity = newCapacity;
+        return;
+    }
+
+    // the characters stay in place while the new capacity fits their block,
+    // so growth from the default capacity allocates only once per size class,
+    // and huge blocks are remapped rather than copied
+    characters = DynamicStringAllocator::Reallocate(characters, capacity + 1, newCapacity + 1, length + 1);
     capacity = newCapacity;
 }
 
@@ -228,9 +433,8 @@ DynamicString operator+(const DynamicString& first, const DynamicString& second)
 
 std::ostream& operator<<(std::ostream& stream, const DynamicString& string)
 {
-    const char* characters = string.Characters();
-    stream << (characters ? characters : "");
-    return stream;
+    // the length is known, so the characters are not scanned again
+    return stream << DynamicStringView(string);
 }
 
 std::istream& operator>>(std::istream& stream, DynamicString& string)
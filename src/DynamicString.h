@@ -2,10 +2,19 @@
 
 #include <assert.h>
 #include <cstring>
+#include <functional>
+#if __cplusplus >= 202002L
+#include <compare>
+#endif
 #include <istream>
+#include <iterator>
 #include <ostream>
+#include <type_traits>
 
 #include "DynamicStringIterator.h"
+#include "DynamicStringSplit.h"
+#include "DynamicStringView.h"
+#include "FixedString.h"
 
 /// @brief A dynamic string for managing sequences of characters.
 class DynamicString
@@ -13,6 +22,9 @@ class DynamicString
 public:
     using Iterator = CharIterator;
 
+    /// @brief The index returned by the search methods when nothing is found.
+    static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
 public:
     /// @brief Default constructor that creates an empty string.
     DynamicString();
@@ -24,8 +36,56 @@ public:
 
     /// @brief Constructor that creates a string consisting of 
     /// the specified characters.
+    /// @param value The null-terminated character sequence to be put in the string.
+    template <typename Pointer, typename std::enable_if<
+        std::is_convertible<Pointer, const char*>::value && !std::is_array<Pointer>::value, int>::type = 0>
+    DynamicString(const Pointer& value)
+    {
+        SetCharacters(value, DEFAULT_CAPACITY);
+    }
+
+    /// @brief Constructor that creates a string consisting of the characters
+    /// of a string literal. The length is taken from the type of the literal,
+    /// so the characters are never counted: every character of the array but
+    /// the null-terminating one is put in the string, null characters within
+    /// the literal included. Constant buffers longer than their contents
+    /// must be passed as pointers, so their characters are counted.
+    /// @param value The string literal to be put in the string.
+    template <size_t N>
+    DynamicString(const char (&value)[N])
+        : DynamicString(value, N - 1)
+    {
+        assert(value[N - 1] == '\0');
+    }
+
+    /// @brief Constructor that creates a string consisting of the characters of
+    /// a writable buffer, which are counted up to the null-terminating character.
+    /// @param value The null-terminated buffer to be put in the string.
+    template <size_t N>
+    DynamicString(char (&value)[N])
+        : DynamicString(static_cast<const char*>(value))
+    { }
+
+    /// @brief Constructor that creates a string consisting of
+    /// the characters of the specified fixed string.
+    /// @param value The fixed string to be put in the string.
+    template <size_t N>
+    DynamicString(const FixedString<N>& value)
+        : DynamicString(value.Characters(), N)
+    { }
+
+    /// @brief Constructor that creates a string consisting of the specified
+    /// number of characters of the character sequence.
     /// @param value The character sequence to be put in the string.
-    DynamicString(const char* value);
+    /// @param length The number of characters to be put in the string.
+    DynamicString(const char* value, size_t length);
+
+    /// @brief Constructor that creates a string consisting of 
+    /// a copy of the viewed characters.
+    /// @param view The characters to be put in the string.
+    explicit DynamicString(DynamicStringView view)
+        : DynamicString(view.Characters(), view.Length())
+    { }
 
     /// @brief A copy constructor that creates a copy of another dynamic string.
     /// @param other The string to be copied.
@@ -48,15 +108,90 @@ public:
     /// @param value The string to be concatenated.
     void Concatenate(const char* value);
 
+    /// @brief Concatenates the specified number of characters
+    /// of the character sequence to the dynamic string.
+    /// @param value The character sequence to be concatenated.
+    /// @param valueLength The number of characters to be concatenated.
+    void Concatenate(const char* value, size_t valueLength);
+
     /// @brief Removes a character from the dynamic string at the specified index.
     /// @param index The index of a character within the string to be removed. 
     void Remove(size_t index);
 
+    /// @brief Shortens the dynamic string to the specified length keeping its capacity,
+    /// so the characters can be reused without reallocating them.
+    /// @param newLength The new length, which must not exceed the current one.
+    void Truncate(size_t newLength);
+
     /// @brief Inserts a character at the specified index within the dynamic string.
     /// @param index The index of a character to be inserted within the string.
     /// @param character The character to be inserted.
     void Insert(size_t index, char character);
 
+    /// @brief Replaces all the occurrences of the specified character with another one.
+    /// @param from The character to be replaced.
+    /// @param to The character to replace with.
+    /// @return The number of characters replaced.
+    size_t ReplaceAll(char from, char to);
+
+    /// @brief Replaces all the non-overlapping occurrences of the specified character
+    /// sequence with another one, scanning from left to right. The matches are
+    /// counted first, so the result is sized once: it is written in place when
+    /// the replacement is not longer than the pattern, otherwise into a single
+    /// new block of memory. An empty pattern is never replaced.
+    /// @param from The character sequence to be replaced.
+    /// @param to The character sequence to replace with.
+    /// @return The number of occurrences replaced.
+    size_t ReplaceAll(DynamicStringView from, DynamicStringView to);
+
+    /// @brief Converts the ASCII letters of the dynamic string to lower case in place.
+    /// Case insensitive orders compare such strings as plain bytes, so strings
+    /// converted once need not be folded again on every comparison.
+    void ToLower();
+
+    /// @brief Converts the ASCII letters of the dynamic string to upper case in place.
+    void ToUpper();
+
+    /// @brief Removes the leading and trailing whitespace in place keeping the capacity.
+    void Trim();
+
+    /// @brief Removes the leading whitespace in place keeping the capacity.
+    void TrimLeft();
+
+    /// @brief Removes the trailing whitespace in place keeping the capacity.
+    void TrimRight();
+
+    /// @brief Returns a copy of the dynamic string with its ASCII letters in lower case.
+    /// The characters are converted while they are copied.
+    /// @return The converted copy.
+    DynamicString ToLowerCopy() const;
+
+    /// @brief Returns a copy of the dynamic string with its ASCII letters in upper case.
+    /// The characters are converted while they are copied.
+    /// @return The converted copy.
+    DynamicString ToUpperCopy() const;
+
+    /// @brief Returns a copy of the dynamic string without the leading and trailing whitespace.
+    /// @return The trimmed copy.
+    DynamicString TrimCopy() const { return DynamicString(DynamicStringView(*this).Trim()); }
+
+    /// @brief Returns a copy of the dynamic string without the leading whitespace.
+    /// @return The trimmed copy.
+    DynamicString TrimLeftCopy() const { return DynamicString(DynamicStringView(*this).TrimLeft()); }
+
+    /// @brief Returns a copy of the dynamic string without the trailing whitespace.
+    /// @return The trimmed copy.
+    DynamicString TrimRightCopy() const { return DynamicString(DynamicStringView(*this).TrimRight()); }
+
+    /// @brief Returns a value indicating whether all the characters are ASCII.
+    /// @return true if no character has its high bit set.
+    bool IsAscii() const { return DynamicStringView(*this).IsAscii(); }
+
+    /// @brief Returns a value indicating whether all the characters are whitespace.
+    /// An empty string is all whitespace.
+    /// @return true if the string has no other characters than whitespace.
+    bool IsAllWhitespace() const { return DynamicStringView(*this).IsAllWhitespace(); }
+
     /// @brief Ensures that the capacity of the dynamic string is at least the 
     /// specified value. If new capacity is greater than the current capacity, 
     /// then the capacity is set to capacity; otherwise the capacity is unchanged.
@@ -64,16 +199,28 @@ public:
     /// @return New capacity of the dynamic string.
     size_t Reserve(size_t newCapacity);
 
+    /// @brief Reduces the capacity of the dynamic string to its length, giving
+    /// the unused memory back. Huge strings give their unused pages back to
+    /// the system without moving the characters.
+    void ShrinkToFit();
+
     /// @brief Sets the dynamic string to the empty string,
     /// clearing all its contents and setting its length to zero 
     /// and capacity to one.
     void Clear();
 
     /// @brief Returns a value indicating whether the characters in this instance
-    /// are equal to a specified dynamic string.
+    /// are equal to a specified dynamic string. Strings of different lengths
+    /// are told apart without reading their characters.
     /// @param other An object to compare with the dynamic string.
     /// @return true if this instance and the specified string have equal char sequences.
-    bool Equals(const DynamicString& other) const { return Equals(other.characters); }
+    bool Equals(const DynamicString& other) const { return DynamicStringView(*this).Equals(other); }
+
+    /// @brief Returns a value indicating whether the characters in this instance
+    /// are equal to the viewed characters.
+    /// @param other A view to compare with the dynamic string.
+    /// @return true if this instance and the specified view have equal char sequences.
+    bool Equals(DynamicStringView other) const { return DynamicStringView(*this).Equals(other); }
 
     /// @brief Returns a value indicating whether the characters in this instance 
     /// are equal to the characters in a specified character sequence.
@@ -81,6 +228,31 @@ public:
     /// @return true if this instance and the specified string have equal char sequences.
     bool Equals(const char* otherCharacters) const;
 
+    /// @brief Compares the characters of this instance with the specified 
+    /// characters lexicographically, byte by byte as unsigned values.
+    /// @param other The characters to compare with the dynamic string.
+    /// @return A negative value if this string goes first, zero if both are equal,
+    /// and a positive value if this string goes after the other one.
+    int Compare(DynamicStringView other) const { return DynamicStringView(*this).Compare(other); }
+
+    /// @brief Finds the first occurrence of the specified character sequence 
+    /// at or after the specified index. A pattern of DynamicStringSearcher::LONG_PATTERN_LENGTH
+    /// or more characters may get a skip table built for every call, so repeated
+    /// searches of the same long pattern should use a DynamicStringSearcher.
+    /// @param pattern The character sequence to search for.
+    /// @param offset The index to start the search at.
+    /// @return The index of the occurrence or NOT_FOUND.
+    size_t Find(DynamicStringView pattern, size_t offset = 0) const;
+
+    /// @brief Finds the first occurrence of the specified character sequence 
+    /// at or after the specified index comparing characters case insensitive.
+    /// The pattern is folded and its skip table is built for every call, so
+    /// repeated searches of the same pattern should use a DynamicStringSearcher.
+    /// @param pattern The character sequence to search for.
+    /// @param offset The index to start the search at.
+    /// @return The index of the occurrence or NOT_FOUND.
+    size_t FindCaseInsensitive(DynamicStringView pattern, size_t offset = 0) const;
+
     /// @brief Returns the number of characters within the string 
     /// without a null-terminating character.
     /// @return The number of characters within the string 
@@ -107,6 +279,63 @@ public:
     /// last character in the dynamic string.
     Iterator end() const { return Iterator(characters + length); }
 
+    /// @brief Returns a lazy range of views of the fields of the string
+    /// separated by the specified character.
+    /// @param delimiter The character separating the fields.
+    /// @return A lazy range of views of the fields.
+    DynamicStringSplitRange Split(char delimiter) const
+    {
+        return DynamicStringSplitRange::Split(*this, delimiter);
+    }
+
+    /// @brief Returns a lazy range of views of the fields of the string
+    /// separated by the specified character sequence.
+    /// @param delimiter The character sequence separating the fields.
+    /// @return A lazy range of views of the fields.
+    DynamicStringSplitRange Split(DynamicStringView delimiter) const
+    {
+        return DynamicStringSplitRange::Split(*this, delimiter);
+    }
+
+    /// @brief Returns a lazy range of views of the fields of the string
+    /// separated by any of the characters of the specified set.
+    /// @param delimiters The set of characters separating the fields.
+    /// @return A lazy range of views of the fields.
+    DynamicStringSplitRange SplitAny(DynamicStringView delimiters) const
+    {
+        return DynamicStringSplitRange::SplitAny(*this, delimiters);
+    }
+
+    /// @brief Returns a lazy range of views of the non-empty tokens of the
+    /// string separated by any number of the characters of the specified set.
+    /// @param delimiters The set of characters separating the tokens.
+    /// @return A lazy range of views of the non-empty tokens.
+    DynamicStringSplitRange Tokenize(DynamicStringView delimiters) const
+    {
+        return DynamicStringSplitRange::Tokenize(*this, delimiters);
+    }
+
+    /// @brief Joins the strings of the specified range putting the separator
+    /// between each two of them. The total length is computed first, so the
+    /// result is written into a single allocation.
+    /// @param first An iterator to the first string to be joined.
+    /// @param last An iterator one past the last string to be joined.
+    /// @param separator The characters to be put between the strings.
+    /// @return The joined string.
+    template <typename ForwardIterator>
+    static DynamicString Join(ForwardIterator first, ForwardIterator last, DynamicStringView separator);
+
+    /// @brief Joins the strings of the specified range putting the separator
+    /// between each two of them. The result is written into a single allocation.
+    /// @param range The strings to be joined.
+    /// @param separator The characters to be put between the strings.
+    /// @return The joined string.
+    template <typename Range>
+    static DynamicString Join(const Range& range, DynamicStringView separator)
+    {
+        return Join(std::begin(range), std::end(range), separator);
+    }
+
 public:
     /// @brief Returns a character of a string at the specified index.
     /// @param index The index within the string at which the character will be returned. 
@@ -149,11 +378,19 @@ public:
     /// @return True if strings do not equal, otherwise false.
     bool operator!=(const DynamicString& other) const { return !(*this == other); }
 
+    /// @brief Converts the dynamic string to a read-only view of its characters.
+    /// The view is valid until the string is modified or destroyed.
+    operator DynamicStringView() const 
+    {
+        return DynamicStringView(characters, length);
+    }
+
 private:
     /// @brief Assings the specified char sequence as the new data 
     /// for the dynamic string. 
     /// @param value The char sequence to be assigned.
-    void SetCharacters(const char* value);
+    /// @param minimumCapacity The capacity to keep if the sequence is shorter.
+    void SetCharacters(const char* value, size_t minimumCapacity);
 
     /// @brief Performs a deep copy of the specified dynamic string.
     /// @param other The string to be deep copied.
@@ -164,8 +401,8 @@ private:
     /// @param other A dynamic string rvalue object to be moved.
     void ShallowCopyFrom(DynamicString&& other);
 
-    /// @brief Allocates a new block of memory and moves all 
-    /// the existing elements into this new block.
+    /// @brief Allocates a new block of memory from DynamicStringAllocator and
+    /// moves all the existing elements into this new block.
     /// @param newCapacity The capacity of the new block of memory.
     void Reallocate(size_t newCapacity);
 
@@ -178,6 +415,83 @@ private:
     size_t capacity = 0;
 };
 
+template <typename ForwardIterator>
+DynamicString DynamicString::Join(ForwardIterator first, ForwardIterator last, DynamicStringView separator)
+{
+    size_t totalLength = 0;
+    size_t count = 0;
+    for (ForwardIterator current = first; current != last; ++current, count++)
+        totalLength += DynamicStringView(*current).Length();
+    if (count > 1)
+        totalLength += (count - 1) * separator.Length();
+
+    DynamicString result(totalLength);
+    for (ForwardIterator current = first; current != last; ++current)
+    {
+        if (current != first)
+            result.Concatenate(separator.Characters(), separator.Length());
+
+        DynamicStringView view(*current);
+        result.Concatenate(view.Characters(), view.Length());
+    }
+    return result;
+}
+
+// Comparison operators outside of the main class.
+// Dynamic strings are compared with C-strings and views directly,
+// without creating a temporary dynamic string for the other operand.
+
+inline bool operator==(const DynamicString& first, DynamicStringView second) { return first.Equals(second); }
+inline bool operator==(DynamicStringView first, const DynamicString& second) { return second.Equals(first); }
+inline bool operator==(const DynamicString& first, const char* second) { return first.Equals(second); }
+inline bool operator==(const char* first, const DynamicString& second) { return second.Equals(first); }
+inline bool operator!=(const DynamicString& first, DynamicStringView second) { return !first.Equals(second); }
+inline bool operator!=(DynamicStringView first, const DynamicString& second) { return !second.Equals(first); }
+inline bool operator!=(const DynamicString& first, const char* second) { return !first.Equals(second); }
+inline bool operator!=(const char* first, const DynamicString& second) { return !second.Equals(first); }
+inline bool operator<(const DynamicString& first, const DynamicString& second) { return first.Compare(second) < 0; }
+inline bool operator<(const DynamicString& first, DynamicStringView second) { return first.Compare(second) < 0; }
+inline bool operator<(DynamicStringView first, const DynamicString& second) { return first.Compare(second) < 0; }
+inline bool operator<(const DynamicString& first, const char* second) { return first.Compare(second) < 0; }
+inline bool operator<(const char* first, const DynamicString& second) { return DynamicStringView(first).Compare(second) < 0; }
+inline bool operator<=(const DynamicString& first, const DynamicString& second) { return first.Compare(second) <= 0; }
+inline bool operator<=(const DynamicString& first, DynamicStringView second) { return first.Compare(second) <= 0; }
+inline bool operator<=(DynamicStringView first, const DynamicString& second) { return first.Compare(second) <= 0; }
+inline bool operator<=(const DynamicString& first, const char* second) { return first.Compare(second) <= 0; }
+inline bool operator<=(const char* first, const DynamicString& second) { return DynamicStringView(first).Compare(second) <= 0; }
+inline bool operator>(const DynamicString& first, const DynamicString& second) { return first.Compare(second) > 0; }
+inline bool operator>(const DynamicString& first, DynamicStringView second) { return first.Compare(second) > 0; }
+inline bool operator>(DynamicStringView first, const DynamicString& second) { return first.Compare(second) > 0; }
+inline bool operator>(const DynamicString& first, const char* second) { return first.Compare(second) > 0; }
+inline bool operator>(const char* first, const DynamicString& second) { return DynamicStringView(first).Compare(second) > 0; }
+inline bool operator>=(const DynamicString& first, const DynamicString& second) { return first.Compare(second) >= 0; }
+inline bool operator>=(const DynamicString& first, DynamicStringView second) { return first.Compare(second) >= 0; }
+inline bool operator>=(DynamicStringView first, const DynamicString& second) { return first.Compare(second) >= 0; }
+inline bool operator>=(const DynamicString& first, const char* second) { return first.Compare(second) >= 0; }
+inline bool operator>=(const char* first, const DynamicString& second) { return DynamicStringView(first).Compare(second) >= 0; }
+
+#if __cplusplus >= 202002L
+/// @brief Three-way comparison operator that orders dynamic strings
+/// lexicographically, byte by byte as unsigned values.
+/// @param first The first string to be compared.
+/// @param second The characters to be compared with.
+/// @return The ordering of the first string relative to the second characters.
+inline std::strong_ordering operator<=>(const DynamicString& first, const DynamicString& second)
+{
+    return first.Compare(second) <=> 0;
+}
+
+inline std::strong_ordering operator<=>(const DynamicString& first, DynamicStringView second)
+{
+    return first.Compare(second) <=> 0;
+}
+
+inline std::strong_ordering operator<=>(const DynamicString& first, const char* second)
+{
+    return first.Compare(second) <=> 0;
+}
+#endif
+
 // Plus operator outside of the main class
 
 /// @brief Plus operator that concatenates dynamic string and a C-string 
@@ -211,4 +525,29 @@ std::ostream& operator<<(std::ostream& stream, const DynamicString& string);
 /// @param stream The input stream to read from.
 /// @param string The string to be assigned to the read value.
 /// @return The input stream.
-std::istream& operator>>(std::istream& stream, DynamicString& string);
\ No newline at end of file
+std::istream& operator>>(std::istream& stream, DynamicString& string);
+
+namespace std
+{
+    /// @brief Hashes dynamic strings by their characters, so they can be
+    /// used as keys of unordered containers.
+    template <>
+    struct hash<DynamicString>
+    {
+        size_t operator()(const DynamicString& string) const
+        {
+            return static_cast<size_t>(DynamicStringView(string).Hash());
+        }
+    };
+
+    /// @brief Hashes views by the viewed characters, so they can be
+    /// used as keys of unordered containers.
+    template <>
+    struct hash<DynamicStringView>
+    {
+        size_t operator()(DynamicStringView view) const
+        {
+            return static_cast<size_t>(view.Hash());
+        }
+    };
+}
\ No newline at end of file
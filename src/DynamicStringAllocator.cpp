@@ -0,0 +1,295 @@
+#include "DynamicStringAllocator.h"
+
+#include <cstring>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#ifdef DYNSTR_HAS_MMAP
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+constexpr size_t DynamicStringAllocator::MIN_BLOCK_SIZE;
+constexpr size_t DynamicStringAllocator::MAX_POOLED_SIZE;
+constexpr size_t DynamicStringAllocator::MIN_HUGE_SIZE;
+
+#ifdef DYNSTR_HAS_MMAP
+
+static size_t RoundToPages(size_t size)
+{
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return (size + pageSize - 1) & ~(pageSize - 1);
+}
+
+static char* MapHuge(size_t size)
+{
+    void* block = mmap(nullptr, RoundToPages(size), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (block == MAP_FAILED)
+        throw std::bad_alloc();
+    return static_cast<char*>(block);
+}
+
+#endif
+
+#ifndef DYNSTR_DISABLE_POOL
+
+/// @brief The number of size classes from MIN_BLOCK_SIZE to MAX_POOLED_SIZE.
+static constexpr size_t CLASS_COUNT = 9;
+
+/// @brief The number of blocks moved between a thread and the shared pool at once.
+static constexpr size_t BATCH_SIZE = 32;
+
+/// @brief The number of bytes carved into blocks when the shared pool runs dry.
+static constexpr size_t SLAB_SIZE = 64 * 1024;
+
+/// @brief Represents a free block, which links to the next free block of its class.
+struct FreeBlock
+{
+    FreeBlock* next;
+};
+
+/// @brief Represents a list of free blocks of the same class.
+struct FreeList
+{
+    FreeBlock* head = nullptr;
+    size_t count = 0;
+
+    void Push(FreeBlock* block)
+    {
+        block->next = head;
+        head = block;
+        count++;
+    }
+
+    FreeBlock* Pop()
+    {
+        FreeBlock* block = head;
+        head = block->next;
+        count--;
+        return block;
+    }
+};
+
+/// @brief Represents the pool shared by all the threads, which holds batches
+/// of free blocks and the slabs they have been carved from.
+struct SharedPool
+{
+    std::mutex mutex;
+    std::vector<FreeList> batches[CLASS_COUNT];
+    std::vector<char*> slabs;
+
+    /// @brief Hands a batch of free blocks over to the pool.
+    void Give(size_t sizeClass, FreeList batch)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        batches[sizeClass].push_back(batch);
+    }
+
+    /// @brief Takes a batch of free blocks from the pool, carving a new slab if it has none.
+    FreeList Take(size_t sizeClass)
+    {
+        size_t blockSize = DynamicStringAllocator::MIN_BLOCK_SIZE << sizeClass;
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!batches[sizeClass].empty())
+        {
+            FreeList batch = batches[sizeClass].back();
+            batches[sizeClass].pop_back();
+            return batch;
+        }
+
+        char* slab = new char[SLAB_SIZE];
+        slabs.push_back(slab);
+
+        // the slab is split into batches, so a thread does not take all of its blocks
+        FreeList batch;
+        for (size_t offset = 0; offset + blockSize <= SLAB_SIZE; offset += blockSize)
+        {
+            if (batch.count == BATCH_SIZE)
+            {
+                batches[sizeClass].push_back(batch);
+                batch = FreeList();
+            }
+            batch.Push(reinterpret_cast<FreeBlock*>(slab + offset));
+        }
+        return batch;
+    }
+};
+
+/// @brief Returns the shared pool, which is never destroyed, since strings
+/// with static storage duration may be destroyed after any other object.
+static SharedPool& Shared()
+{
+    static SharedPool* pool = new SharedPool;
+    return *pool;
+}
+
+/// @brief The free lists of the current thread, which are used without locking.
+/// They are plain arrays, so using them needs no initialization checks.
+static thread_local FreeList cache[CLASS_COUNT];
+
+/// @brief Set once the cache of the current thread is flushed at its exit; blocks freed
+/// afterwards, e.g. by destructors of static strings, go to the shared pool.
+static thread_local bool cacheDestroyed = false;
+
+/// @brief Represents the object that gives the cached blocks back to the shared pool
+/// when its thread exits. It is only touched when a free list of the thread
+/// becomes non-empty, which keeps the common paths free of its initialization check.
+struct ThreadCacheFlusher
+{
+    bool registered = false;
+
+    ~ThreadCacheFlusher()
+    {
+        for (size_t sizeClass = 0; sizeClass < CLASS_COUNT; sizeClass++)
+            if (cache[sizeClass].count > 0)
+                Shared().Give(sizeClass, cache[sizeClass]);
+        cacheDestroyed = true;
+    }
+};
+
+static thread_local ThreadCacheFlusher flusher;
+
+static size_t ClassOf(size_t size)
+{
+    if (size <= DynamicStringAllocator::MIN_BLOCK_SIZE)
+        return 0;
+#if defined(__GNUC__)
+    // the number of bits needed for size - 1 is the logarithm of the block size
+    return 64 - __builtin_clzll(static_cast<unsigned long long>(size - 1)) - 4;
+#else
+    size_t sizeClass = 0;
+    for (size_t blockSize = DynamicStringAllocator::MIN_BLOCK_SIZE; blockSize < size; blockSize *= 2)
+        sizeClass++;
+    return sizeClass;
+#endif
+}
+
+static char* AllocatePooled(size_t size)
+{
+    size_t sizeClass = ClassOf(size);
+    if (cacheDestroyed)
+    {
+        // taking a whole batch for a single block and giving the rest back
+        FreeList batch = Shared().Take(sizeClass);
+        FreeBlock* block = batch.Pop();
+        if (batch.count > 0)
+            Shared().Give(sizeClass, batch);
+        return reinterpret_cast<char*>(block);
+    }
+
+    FreeList& list = cache[sizeClass];
+    if (list.count == 0)
+    {
+        flusher.registered = true;
+        list = Shared().Take(sizeClass);
+    }
+    return reinterpret_cast<char*>(list.Pop());
+}
+
+static void DeallocatePooled(char* block, size_t size)
+{
+    size_t sizeClass = ClassOf(size);
+    if (cacheDestroyed)
+    {
+        FreeList batch;
+        batch.Push(reinterpret_cast<FreeBlock*>(block));
+        Shared().Give(sizeClass, batch);
+        return;
+    }
+
+    // keeping up to two batches, so a thread freeing and allocating
+    // around the limit does not move a batch back and forth every time
+    FreeList& list = cache[sizeClass];
+    if (list.count == 0)
+        flusher.registered = true;
+    list.Push(reinterpret_cast<FreeBlock*>(block));
+    if (list.count > 2 * BATCH_SIZE)
+    {
+        FreeList batch;
+        while (batch.count < BATCH_SIZE)
+            batch.Push(list.Pop());
+        Shared().Give(sizeClass, batch);
+    }
+}
+
+#endif
+
+char* DynamicStringAllocator::Allocate(size_t size)
+{
+#ifdef DYNSTR_HAS_MMAP
+    if (size >= MIN_HUGE_SIZE)
+        return MapHuge(size);
+#endif
+#ifndef DYNSTR_DISABLE_POOL
+    if (size <= MAX_POOLED_SIZE)
+        return AllocatePooled(size);
+#endif
+    return new char[size];
+}
+
+void DynamicStringAllocator::Deallocate(char* block, size_t size)
+{
+    if (!block) return;
+
+#ifdef DYNSTR_HAS_MMAP
+    if (size >= MIN_HUGE_SIZE)
+    {
+        munmap(block, RoundToPages(size));
+        return;
+    }
+#endif
+#ifndef DYNSTR_DISABLE_POOL
+    if (size <= MAX_POOLED_SIZE)
+    {
+        DeallocatePooled(block, size);
+        return;
+    }
+#endif
+    delete[] block;
+}
+
+char* DynamicStringAllocator::Reallocate(char* block, size_t size, size_t newSize, size_t usedSize)
+{
+    if (BlockSize(newSize) == BlockSize(size))
+        return block;
+
+#ifdef DYNSTR_HAS_MMAP
+    if (size >= MIN_HUGE_SIZE && newSize >= MIN_HUGE_SIZE)
+    {
+        size_t mapped = RoundToPages(size);
+        size_t newMapped = RoundToPages(newSize);
+        // the pages past the new end are given back to the system
+        if (newMapped < mapped)
+        {
+            munmap(block + newMapped, mapped - newMapped);
+            return block;
+        }
+#ifdef __linux__
+        // the pages are moved to a larger range of addresses without copying them
+        void* remapped = mremap(block, mapped, newMapped, MREMAP_MAYMOVE);
+        if (remapped == MAP_FAILED)
+            throw std::bad_alloc();
+        return static_cast<char*>(remapped);
+#endif
+    }
+#endif
+
+    char* newBlock = Allocate(newSize);
+    memcpy(newBlock, block, usedSize < newSize ? usedSize : newSize);
+    Deallocate(block, size);
+    return newBlock;
+}
+
+size_t DynamicStringAllocator::BlockSize(size_t size)
+{
+#ifdef DYNSTR_HAS_MMAP
+    if (size >= MIN_HUGE_SIZE)
+        return RoundToPages(size);
+#endif
+#ifndef DYNSTR_DISABLE_POOL
+    if (size <= MAX_POOLED_SIZE)
+        return MIN_BLOCK_SIZE << ClassOf(size);
+#endif
+    return size;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define DYNSTR_HAS_MMAP
+#endif
+
+/// @brief Represents a static class that provides the memory of dynamic strings.
+/// Small blocks are rounded up to power-of-two size classes and recycled:
+/// every thread keeps free lists of its own, so allocating and freeing a block
+/// usually takes no lock at all, and blocks move between the threads and a shared
+/// pool in batches. Blocks larger than MAX_POOLED_SIZE come from the global heap.
+///
+/// Huge blocks of at least MIN_HUGE_SIZE bytes are mapped from the system
+/// directly (with mmap() on POSIX systems) in whole pages, so they can grow
+/// and shrink without copying their contents where the system allows it
+/// (with mremap() on Linux).
+///
+/// Defining DYNSTR_DISABLE_POOL makes every small block come from the global
+/// heap, which lets memory checkers see each block separately.
+class DynamicStringAllocator
+{
+public:
+    /// @brief The size of the smallest size class.
+    static constexpr size_t MIN_BLOCK_SIZE = 16;
+
+    /// @brief The size of the largest size class; larger blocks are not pooled.
+    static constexpr size_t MAX_POOLED_SIZE = 4096;
+
+    /// @brief The size from which blocks are mapped from the system in whole pages.
+    static constexpr size_t MIN_HUGE_SIZE = 1024 * 1024;
+
+public:
+    /// @brief Allocates a block of at least the specified number of bytes.
+    /// @param size The number of bytes needed.
+    /// @return The allocated block.
+    static char* Allocate(size_t size);
+
+    /// @brief Frees a block allocated by Allocate().
+    /// @param block The block to be freed.
+    /// @param size The number of bytes the block has been allocated for,
+    /// or any other number of bytes with the same block size.
+    static void Deallocate(char* block, size_t size);
+
+    /// @brief Resizes a block keeping its first bytes. The block is kept if the
+    /// new size has the same block size, and huge blocks are resized in place
+    /// or remapped rather than copied whenever the system allows it.
+    /// @param block The block to be resized.
+    /// @param size The number of bytes the block has been allocated for.
+    /// @param newSize The number of bytes needed.
+    /// @param usedSize The number of first bytes to be kept.
+    /// @return The resized block, which may have moved.
+    static char* Reallocate(char* block, size_t size, size_t newSize, size_t usedSize);
+
+    /// @brief Returns the number of bytes actually usable in a block allocated
+    /// for the specified number of bytes.
+    /// @param size The number of bytes needed.
+    /// @return The number of bytes usable in the block.
+    static size_t BlockSize(size_t size);
+};
@@ -0,0 +1,290 @@
+#include "DynamicStringArchive.h"
+
+#ifdef DYNSTR_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#endif
+
+constexpr uint32_t DynamicStringArchive::VERSION;
+constexpr uint32_t DynamicStringArchive::BYTE_ORDER_MARK;
+constexpr size_t DynamicStringArchive::HEADER_SIZE;
+constexpr size_t DynamicStringArchive::TRAILER_SIZE;
+
+const char DynamicStringArchive::MAGIC[8] = { 'D', 'Y', 'N', 'S', 'T', 'R', 'A', '\x1A' };
+
+/// @brief Rounds the size up to keep the table of offsets aligned.
+static uint64_t AlignOffsets(uint64_t size)
+{
+    return (size + alignof(uint64_t) - 1) & ~static_cast<uint64_t>(alignof(uint64_t) - 1);
+}
+
+void DynamicStringArchive::Checksum::Update(const char* bytes, size_t size)
+{
+    total += size;
+
+    // completing the block left over from the previous bytes
+    if (pendingSize > 0)
+    {
+        size_t taken = 8 - pendingSize < size ? 8 - pendingSize : size;
+        memcpy(pending + pendingSize, bytes, taken);
+        pendingSize += taken;
+        bytes += taken;
+        size -= taken;
+
+        if (pendingSize < 8)
+            return;
+
+        uint64_t block;
+        memcpy(&block, pending, 8);
+        Mix(block);
+        pendingSize = 0;
+    }
+
+    for (; size >= 8; size -= 8, bytes += 8)
+    {
+        uint64_t block;
+        memcpy(&block, bytes, 8);
+        Mix(block);
+    }
+
+    memcpy(pending, bytes, size);
+    pendingSize = size;
+}
+
+uint64_t DynamicStringArchive::Checksum::Value() const
+{
+    const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+    uint64_t value = state;
+    if (pendingSize > 0)
+    {
+        uint64_t block = 0;
+        memcpy(&block, pending, pendingSize);
+        value = (value ^ block) * multiplier;
+        value ^= value >> 29;
+    }
+
+    // finalizing the same way as DynamicStringView::Hash()
+    value ^= total * multiplier;
+    value ^= value >> 32;
+    value *= 0xD6E8FEB86659FD93ull;
+    value ^= value >> 32;
+    return value;
+}
+
+void DynamicStringArchive::Checksum::Mix(uint64_t block)
+{
+    const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+    state = (state ^ block) * multiplier;
+    state ^= state >> 29;
+}
+
+DynamicStringArchive::DynamicStringArchive(DynamicStringArchive&& other) noexcept
+    : file(other.file), fileSize(other.fileSize), data(other.data), offsets(other.offsets), count(other.count)
+{
+    other.file = nullptr;
+    other.Close();
+}
+
+DynamicStringArchive::~DynamicStringArchive()
+{
+    Close();
+}
+
+bool DynamicStringArchive::Open(const char* path, bool verifyChecksum)
+{
+    Close();
+
+#ifdef DYNSTR_HAS_MMAP
+    int fileDescriptor = open(path, O_RDONLY);
+    if (fileDescriptor < 0)
+        return false;
+
+    struct stat status;
+    if (fstat(fileDescriptor, &status) != 0 || status.st_size < static_cast<off_t>(HEADER_SIZE + TRAILER_SIZE))
+    {
+        close(fileDescriptor);
+        return false;
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    void* mapping = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (mapping == MAP_FAILED)
+        return false;
+
+    file = static_cast<const char*>(mapping);
+    fileSize = static_cast<size_t>(status.st_size);
+#else
+    std::ifstream stream(path, std::ios::binary | std::ios::ate);
+    if (!stream)
+        return false;
+
+    std::streamoff size = stream.tellg();
+    if (size < static_cast<std::streamoff>(HEADER_SIZE + TRAILER_SIZE))
+        return false;
+
+    char* contents = new char[static_cast<size_t>(size)];
+    stream.seekg(0);
+    if (!stream.read(contents, size))
+    {
+        delete[] contents;
+        return false;
+    }
+
+    file = contents;
+    fileSize = static_cast<size_t>(size);
+#endif
+
+    if (!Validate(verifyChecksum))
+    {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void DynamicStringArchive::Close()
+{
+    if (file)
+    {
+#ifdef DYNSTR_HAS_MMAP
+        munmap(const_cast<char*>(file), fileSize);
+#else
+        delete[] file;
+#endif
+    }
+
+    file = nullptr;
+    fileSize = 0;
+    data = nullptr;
+    offsets = nullptr;
+    count = 0;
+}
+
+std::vector<DynamicString> DynamicStringArchive::ToStrings() const
+{
+    std::vector<DynamicString> strings;
+    strings.reserve(count);
+    for (DynamicStringView view : *this)
+        strings.emplace_back(view.Characters(), view.Length());
+    return strings;
+}
+
+DynamicStringArchive& DynamicStringArchive::operator=(DynamicStringArchive&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        file = other.file;
+        fileSize = other.fileSize;
+        data = other.data;
+        offsets = other.offsets;
+        count = other.count;
+
+        other.file = nullptr;
+        other.Close();
+    }
+    return *this;
+}
+
+bool DynamicStringArchive::Validate(bool verifyChecksum)
+{
+    uint32_t version, byteOrder;
+    memcpy(&version, file + 8, sizeof(version));
+    memcpy(&byteOrder, file + 12, sizeof(byteOrder));
+    if (memcmp(file, MAGIC, sizeof(MAGIC)) != 0 || version != VERSION || byteOrder != BYTE_ORDER_MARK)
+        return false;
+
+    const char* trailer = file + fileSize - TRAILER_SIZE;
+    uint64_t stringCount, dataSize, storedChecksum;
+    memcpy(&stringCount, trailer, 8);
+    memcpy(&dataSize, trailer + 8, 8);
+    memcpy(&storedChecksum, trailer + 16, 8);
+    if (memcmp(trailer + 24, MAGIC, sizeof(MAGIC)) != 0)
+        return false;
+
+    // comparing the sizes in a way that cannot overflow for corrupted counts
+    uint64_t available = fileSize - HEADER_SIZE - TRAILER_SIZE;
+    if (dataSize > available || stringCount >= available / sizeof(uint64_t) ||
+        AlignOffsets(dataSize) + (stringCount + 1) * sizeof(uint64_t) != available)
+        return false;
+
+    data = file + HEADER_SIZE;
+    offsets = reinterpret_cast<const uint64_t*>(data + AlignOffsets(dataSize));
+    count = static_cast<size_t>(stringCount);
+
+    // every view must stay within the strings; only the offsets are read,
+    // so the pages of the strings are not touched while opening
+    if (offsets[0] != 0 || offsets[count] != dataSize)
+        return false;
+    for (size_t i = 0; i < count; i++)
+        if (offsets[i + 1] <= offsets[i])
+            return false;
+
+    if (verifyChecksum)
+    {
+        Checksum checksum;
+        checksum.Update(file, fileSize - TRAILER_SIZE + 16);
+        if (checksum.Value() != storedChecksum)
+            return false;
+
+        // the strings have been read anyway, so their null characters are checked as well
+        for (size_t i = 0; i < count; i++)
+            if (data[offsets[i + 1] - 1] != '\0')
+                return false;
+    }
+    return true;
+}
+
+DynamicStringArchiveWriter::DynamicStringArchiveWriter(DynamicStringWriter& writer)
+    : writer(writer), offsets(1, 0)
+{
+    uint32_t version = DynamicStringArchive::VERSION;
+    uint32_t byteOrder = DynamicStringArchive::BYTE_ORDER_MARK;
+    Emit(DynamicStringArchive::MAGIC, sizeof(DynamicStringArchive::MAGIC));
+    Emit(&version, sizeof(version));
+    Emit(&byteOrder, sizeof(byteOrder));
+}
+
+DynamicStringArchiveWriter& DynamicStringArchiveWriter::Write(DynamicStringView value)
+{
+    assert(!finished);
+
+    // strings are stored with their null characters, so views of them are null-terminated
+    Emit(value.Characters(), value.Length());
+    Emit("", 1);
+    offsets.push_back(offsets.back() + value.Length() + 1);
+    return *this;
+}
+
+bool DynamicStringArchiveWriter::Finish()
+{
+    assert(!finished);
+    finished = true;
+
+    uint64_t dataSize = offsets.back();
+    const char padding[8] = { };
+    Emit(padding, static_cast<size_t>(AlignOffsets(dataSize) - dataSize));
+    Emit(offsets.data(), offsets.size() * sizeof(uint64_t));
+
+    uint64_t count = offsets.size() - 1;
+    Emit(&count, sizeof(count));
+    Emit(&dataSize, sizeof(dataSize));
+
+    // the checksum covers everything before it
+    uint64_t value = checksum.Value();
+    writer.Write(DynamicStringView(reinterpret_cast<const char*>(&value), sizeof(value)));
+    writer.Write(DynamicStringView(DynamicStringArchive::MAGIC, sizeof(DynamicStringArchive::MAGIC)));
+    return writer.Flush();
+}
+
+void DynamicStringArchiveWriter::Emit(const void* bytes, size_t size)
+{
+    const char* characters = static_cast<const char*>(bytes);
+    writer.Write(DynamicStringView(characters, size));
+    checksum.Update(characters, size);
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringAllocator.h"
+#include "DynamicStringView.h"
+#include "DynamicStringWriter.h"
+
+/// @brief Represents a read-only list of strings loaded from a binary archive.
+/// The archive file is mapped into memory (with mmap() on POSIX systems) and
+/// its strings are exposed as views of the mapping, so opening an archive does
+/// not copy or parse the strings however many there are.
+///
+/// An archive consists of a header with a magic number, the format version and
+/// the byte order, the null-terminated strings, a table of their offsets and
+/// a trailer with the number of strings, their total size and a checksum of
+/// everything before it. Archives are written by DynamicStringArchiveWriter.
+class DynamicStringArchive
+{
+public:
+    /// @brief The version of the format written and read by this library.
+    static constexpr uint32_t VERSION = 1;
+
+    /// @brief Represents a 64-bit checksum of bytes fed in pieces of any size.
+    class Checksum
+    {
+    public:
+        /// @brief Feeds the specified bytes into the checksum.
+        /// @param bytes The bytes to be fed.
+        /// @param size The number of bytes.
+        void Update(const char* bytes, size_t size);
+
+        /// @brief Returns the checksum of all the bytes fed so far.
+        /// @return The checksum of all the bytes fed so far.
+        uint64_t Value() const;
+
+    private:
+        void Mix(uint64_t block);
+
+    private:
+        uint64_t state = 0;
+        uint64_t total = 0;
+        char pending[8];
+        size_t pendingSize = 0;
+    };
+
+    /// @brief Represents a forward iterator over the views of the archived strings.
+    class Iterator
+    {
+    public:
+        using value_type = DynamicStringView;
+        using pointer = const DynamicStringView*;
+        using reference = DynamicStringView;
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+
+    public:
+        Iterator() = default;
+
+        Iterator& operator++()
+        {
+            index++;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator iterator = *this;
+            index++;
+            return iterator;
+        }
+
+        DynamicStringView operator*() const { return (*archive)[index]; }
+
+        bool operator==(const Iterator& other) const { return index == other.index; }
+
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    private:
+        friend class DynamicStringArchive;
+
+        Iterator(const DynamicStringArchive* archive, size_t index)
+            : archive(archive), index(index)
+        { }
+
+    private:
+        const DynamicStringArchive* archive = nullptr;
+        size_t index = 0;
+    };
+
+public:
+    /// @brief Constructor that creates an archive with no file opened.
+    DynamicStringArchive() = default;
+
+    DynamicStringArchive(const DynamicStringArchive& other) = delete;
+
+    /// @brief A move constructor that takes over the file of another archive.
+    /// @param other The archive to be moved.
+    DynamicStringArchive(DynamicStringArchive&& other) noexcept;
+
+    /// @brief Closes the file and destroys the archive.
+    ~DynamicStringArchive();
+
+public:
+    /// @brief Opens the archive file at the specified path, closing the one opened before.
+    /// The format and the offsets of the strings are always validated, so every view
+    /// stays within the strings. Verifying the checksum reads the whole file, and then
+    /// every string is checked to end with a null character as well. Without it only
+    /// the offsets are read and opening takes no time however large the strings are,
+    /// but the strings of a damaged archive may lack their null characters.
+    /// @param path The path of the archive file.
+    /// @param verifyChecksum Whether to read the whole file to verify its checksum
+    /// and the null characters of the strings.
+    /// @return true if the archive has been opened.
+    bool Open(const char* path, bool verifyChecksum = true);
+
+    /// @brief Closes the archive file; the views of its strings become invalid.
+    void Close();
+
+    /// @brief Returns a value indicating whether an archive file is opened.
+    /// @return true if an archive file is opened.
+    bool IsOpen() const { return file != nullptr; }
+
+    /// @brief Copies all the archived strings into dynamic strings.
+    /// @return The archived strings.
+    std::vector<DynamicString> ToStrings() const;
+
+    /// @brief Returns the number of archived strings.
+    /// @return The number of archived strings.
+    size_t Size() const { return count; }
+
+    /// @brief Returns an iterator to the first archived string.
+    /// @return An iterator to the first archived string.
+    Iterator begin() const { return Iterator(this, 0); }
+
+    /// @brief Returns an iterator one past the last archived string.
+    /// @return An iterator one past the last archived string.
+    Iterator end() const { return Iterator(this, count); }
+
+public:
+    /// @brief Returns a view of the archived string at the specified index,
+    /// which stays valid until the archive is closed. The length of the view is
+    /// taken from the offsets, so it is right even for a damaged archive opened
+    /// without verifying its checksum, whose strings may lack their null characters.
+    /// @param index The index of the string.
+    /// @return A view of the archived string, null-terminated once the checksum is verified.
+    DynamicStringView operator[](size_t index) const
+    {
+        assert(index < count);
+        return DynamicStringView(data + offsets[index], static_cast<size_t>(offsets[index + 1] - offsets[index] - 1));
+    }
+
+    DynamicStringArchive& operator=(const DynamicStringArchive& other) = delete;
+
+    /// @brief Move assignment operator that closes the file of this archive
+    /// and takes over the file of another one.
+    /// @param other An archive rvalue object to be moved.
+    /// @return A reference to this archive.
+    DynamicStringArchive& operator=(DynamicStringArchive&& other) noexcept;
+
+private:
+    friend class DynamicStringArchiveWriter;
+
+    /// @brief Checks the layout of the loaded file and locates its strings and offsets.
+    bool Validate(bool verifyChecksum);
+
+private:
+    static const char MAGIC[8];
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+    static constexpr size_t HEADER_SIZE = 16;
+    static constexpr size_t TRAILER_SIZE = 32;
+
+    const char* file = nullptr;
+    size_t fileSize = 0;
+
+    const char* data = nullptr;
+    const uint64_t* offsets = nullptr;
+    size_t count = 0;
+};
+
+/// @brief Represents a streaming writer of string archives. The strings are passed
+/// to a DynamicStringWriter as they come, while only their offsets are kept
+/// until the table of offsets is written by Finish().
+class DynamicStringArchiveWriter
+{
+public:
+    /// @brief Constructor that starts an archive by writing its header.
+    /// @param writer The writer receiving the archive; it must outlive this object.
+    explicit DynamicStringArchiveWriter(DynamicStringWriter& writer);
+
+    DynamicStringArchiveWriter(const DynamicStringArchiveWriter& other) = delete;
+
+    DynamicStringArchiveWriter& operator=(const DynamicStringArchiveWriter& other) = delete;
+
+public:
+    /// @brief Appends the viewed string to the archive.
+    /// @param value The string to be archived.
+    /// @return A reference to this archive writer.
+    DynamicStringArchiveWriter& Write(DynamicStringView value);
+
+    /// @brief Completes the archive by writing the table of offsets and the trailer,
+    /// and flushes the underlying writer. No strings can be written afterwards.
+    /// @return true if the whole archive has been written.
+    bool Finish();
+
+    /// @brief Returns the number of strings written so far.
+    /// @return The number of strings written so far.
+    size_t Count() const { return offsets.size() - 1; }
+
+private:
+    /// @brief Writes the bytes out and feeds them into the checksum.
+    void Emit(const void* bytes, size_t size);
+
+private:
+    DynamicStringWriter& writer;
+    DynamicStringArchive::Checksum checksum;
+
+    // the offset of every string from the start of the strings, followed by their total size
+    std::vector<uint64_t> offsets;
+    bool finished = false;
+};
@@ -0,0 +1,159 @@
+#include "DynamicStringBuilder.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+constexpr size_t DynamicStringBuilder::DEFAULT_CHUNK_CAPACITY;
+
+DynamicStringBuilder::DynamicStringBuilder(size_t chunkCapacity)
+    : chunkCapacity(chunkCapacity > 0 ? chunkCapacity : DEFAULT_CHUNK_CAPACITY)
+{ }
+
+DynamicStringBuilder::DynamicStringBuilder(DynamicStringBuilder&& other) noexcept
+    : chunks(std::move(other.chunks)), chunkCapacity(other.chunkCapacity), length(other.length)
+{
+    other.chunks.clear();
+    other.length = 0;
+}
+
+DynamicStringBuilder::~DynamicStringBuilder()
+{
+    Clear();
+}
+
+DynamicStringBuilder& DynamicStringBuilder::Append(char character)
+{
+    if (chunks.empty() || chunks.back().length == chunks.back().capacity)
+        AddChunk(1);
+
+    Chunk& chunk = chunks.back();
+    chunk.characters[chunk.length++] = character;
+    length++;
+    return *this;
+}
+
+DynamicStringBuilder& DynamicStringBuilder::Append(DynamicStringView view)
+{
+    const char* value = view.Characters();
+    size_t remaining = view.Length();
+    length += remaining;
+
+    // filling the free space of the last chunk first
+    if (!chunks.empty())
+    {
+        Chunk& chunk = chunks.back();
+        size_t count = std::min(remaining, chunk.capacity - chunk.length);
+        memcpy(chunk.characters + chunk.length, value, count * sizeof(char));
+        chunk.length += count;
+        value += count;
+        remaining -= count;
+    }
+
+    // a piece longer than a chunk gets a chunk of its own size
+    if (remaining > 0)
+    {
+        AddChunk(remaining);
+        Chunk& chunk = chunks.back();
+        memcpy(chunk.characters, value, remaining * sizeof(char));
+        chunk.length = remaining;
+    }
+    return *this;
+}
+
+DynamicStringBuilder& DynamicStringBuilder::Append(long long value)
+{
+    // negating in unsigned arithmetic to handle the minimum value
+    unsigned long long magnitude = static_cast<unsigned long long>(value);
+    if (value < 0)
+    {
+        Append('-');
+        magnitude = 0 - magnitude;
+    }
+    return Append(magnitude);
+}
+
+DynamicStringBuilder& DynamicStringBuilder::Append(unsigned long long value)
+{
+    char digits[20];
+    size_t count = 0;
+    do
+    {
+        digits[sizeof(digits) - ++count] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+
+    return Append(DynamicStringView(digits + sizeof(digits) - count, count));
+}
+
+DynamicStringBuilder& DynamicStringBuilder::Append(double value)
+{
+    // the shortest precision that reads back to the same value
+    char digits[32];
+    int count = 0;
+    for (int precision = 1; precision <= 17; precision++)
+    {
+        count = snprintf(digits, sizeof(digits), "%.*g", precision, value);
+        if (strtod(digits, nullptr) == value) break;
+    }
+    return Append(DynamicStringView(digits, count));
+}
+
+DynamicString DynamicStringBuilder::Build() const
+{
+    DynamicString result(length);
+    for (const Chunk& chunk : chunks)
+        result.Concatenate(chunk.characters, chunk.length);
+    return result;
+}
+
+void DynamicStringBuilder::Clear()
+{
+    for (Chunk& chunk : chunks)
+        delete[] chunk.characters;
+    chunks.clear();
+    length = 0;
+}
+
+std::vector<DynamicStringView> DynamicStringBuilder::Segments() const
+{
+    std::vector<DynamicStringView> segments;
+    segments.reserve(chunks.size());
+    for (const Chunk& chunk : chunks)
+        if (chunk.length > 0)
+            segments.emplace_back(chunk.characters, chunk.length);
+    return segments;
+}
+
+#ifdef DYNSTR_HAS_IOVEC
+std::vector<iovec> DynamicStringBuilder::Iovecs() const
+{
+    std::vector<iovec> vectors;
+    vectors.reserve(chunks.size());
+    for (const Chunk& chunk : chunks)
+        if (chunk.length > 0)
+            vectors.push_back(iovec { chunk.characters, chunk.length });
+    return vectors;
+}
+#endif
+
+DynamicStringBuilder& DynamicStringBuilder::operator=(DynamicStringBuilder&& other) noexcept
+{
+    if (this != &other)
+    {
+        Clear();
+        chunks = std::move(other.chunks);
+        chunkCapacity = other.chunkCapacity;
+        length = other.length;
+
+        other.chunks.clear();
+        other.length = 0;
+    }
+    return *this;
+}
+
+void DynamicStringBuilder::AddChunk(size_t minimumCapacity)
+{
+    size_t capacity = std::max(minimumCapacity, chunkCapacity);
+    chunks.push_back(Chunk { new char[capacity], 0, capacity });
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#define DYNSTR_HAS_IOVEC
+#endif
+
+#include "DynamicString.h"
+
+/// @brief Represents a builder that assembles a string from many pieces.
+/// Pieces are appended into a chain of fixed-size chunks, so growing the builder
+/// never copies the characters appended earlier, and the resulting dynamic
+/// string is materialized with a single allocation of the exact size.
+class DynamicStringBuilder
+{
+public:
+    /// @brief Constructor that creates an empty builder.
+    /// @param chunkCapacity The number of characters each chunk can hold.
+    /// If zero, the default chunk capacity is used.
+    DynamicStringBuilder(size_t chunkCapacity = DEFAULT_CHUNK_CAPACITY);
+
+    DynamicStringBuilder(const DynamicStringBuilder& other) = delete;
+
+    /// @brief A move constructor that takes over the chunks of another builder.
+    /// @param other The builder to be moved.
+    DynamicStringBuilder(DynamicStringBuilder&& other) noexcept;
+
+    /// @brief Destroy the builder and all of its chunks.
+    ~DynamicStringBuilder();
+
+public:
+    /// @brief Appends the specified character.
+    /// @param character The character to be appended.
+    /// @return A reference to this builder.
+    DynamicStringBuilder& Append(char character);
+
+    /// @brief Appends the specified null-terminated character sequence.
+    /// @param value The character sequence to be appended; nullptr appends nothing.
+    /// @return A reference to this builder.
+    DynamicStringBuilder& Append(const char* value) { return Append(DynamicStringView(value)); }
+
+    /// @brief Appends the characters of the specified dynamic string.
+    /// @param string The string to be appended.
+    /// @return A reference to this builder.
+    DynamicStringBuilder& Append(const DynamicString& string) { return Append(DynamicStringView(string)); }
+
+    /// @brief Appends the viewed characters.
+    /// @param view The characters to be appended.
+    /// @return A reference to this builder.
+    DynamicStringBuilder& Append(DynamicStringView view);
+
+    /// @brief Appends the decimal representation of the specified number.
+    /// @param value The number to be appended.
+    /// @return A reference to this builder.
+    DynamicStringBuilder& Append(int value) { return Append(static_cast<long long>(value)); }
+    DynamicStringBuilder& Append(long value) { return Append(static_cast<long long>(value)); }
+    DynamicStringBuilder& Append(long long value);
+    DynamicStringBuilder& Append(unsigned value) { return Append(static_cast<unsigned long long>(value)); }
+    DynamicStringBuilder& Append(unsigned long value) { return Append(static_cast<unsigned long long>(value)); }
+    DynamicStringBuilder& Append(unsigned long long value);
+
+    /// @brief Appends the shortest representation of the specified number
+    /// that reads back to the same value.
+    /// @param value The number to be appended.
+    /// @return A reference to this builder.
+    DynamicStringBuilder& Append(double value);
+
+    /// @brief Materializes the appended characters into a dynamic string
+    /// with a single allocation of the exact length.
+    /// @return The dynamic string consisting of all the appended characters.
+    DynamicString Build() const;
+
+    /// @brief Removes all the appended characters and releases the chunks.
+    void Clear();
+
+    /// @brief Returns the total number of appended characters.
+    /// @return The total number of appended characters.
+    size_t Length() const { return length; }
+
+    /// @brief Returns views of the filled parts of the chunks in order.
+    /// The views are valid until the builder is modified or destroyed.
+    /// @return Views of the filled parts of the chunks.
+    std::vector<DynamicStringView> Segments() const;
+
+#ifdef DYNSTR_HAS_IOVEC
+    /// @brief Returns the filled parts of the chunks in order as iovec
+    /// structures that can be passed to writev() directly.
+    /// The structures are valid until the builder is modified or destroyed.
+    /// @return The filled parts of the chunks as iovec structures.
+    std::vector<iovec> Iovecs() const;
+#endif
+
+public:
+    DynamicStringBuilder& operator=(const DynamicStringBuilder& other) = delete;
+
+    /// @brief Move assignment operator that releases the chunks of this
+    /// builder and takes over the chunks of another one.
+    /// @param other A builder rvalue object to be moved.
+    /// @return A reference to this builder.
+    DynamicStringBuilder& operator=(DynamicStringBuilder&& other) noexcept;
+
+private:
+    struct Chunk
+    {
+        char* characters;
+        size_t length;
+        size_t capacity;
+    };
+
+    /// @brief Appends a new chunk that can hold at least the specified number of characters.
+    /// @param minimumCapacity The number of characters the chunk must be able to hold.
+    void AddChunk(size_t minimumCapacity);
+
+private:
+    static constexpr size_t DEFAULT_CHUNK_CAPACITY = 4096;
+
+    std::vector<Chunk> chunks;
+    size_t chunkCapacity;
+    size_t length = 0;
+};
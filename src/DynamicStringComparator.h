@@ -9,6 +9,11 @@
 class DynamicStringComparator
 {
 public:
+    static bool Lexicographical(const DynamicString& first, const DynamicString& second)
+    {
+        return first.Compare(second) < 0;
+    }
+
     static bool Lexicographical_Reversed_CaseInsensitive(
         const DynamicString& first, const DynamicString& second)
     {
@@ -17,8 +22,50 @@ public:
             first.begin(), first.end(),
             second.begin(), second.end(),
             [](char lhs, char rhs) { 
-                return std::tolower(lhs) > std::tolower(rhs);
+                return std::tolower(static_cast<unsigned char>(lhs)) > std::tolower(static_cast<unsigned char>(rhs));
             }
         );
     }
+
+    /// @brief Orders strings already converted to lower case the same way
+    /// Lexicographical_Reversed_CaseInsensitive orders them in the default "C"
+    /// locale, comparing their bytes with memcmp() instead of folding the case
+    /// of every character. Both orders compare the bytes as unsigned values, so
+    /// they agree on the bytes past ASCII as well, which neither of them folds.
+    static bool Lexicographical_Reversed(const DynamicString& first, const DynamicString& second)
+    {
+        return Views::Lexicographical_Reversed(first, second);
+    }
+
+    /// @brief Provides the same orders for views of characters, so strings
+    /// stored outside dynamic strings can be sorted without copying them.
+    struct Views
+    {
+        static bool Lexicographical(DynamicStringView first, DynamicStringView second)
+        {
+            return first.Compare(second) < 0;
+        }
+
+        static bool Lexicographical_Reversed(DynamicStringView first, DynamicStringView second)
+        {
+            // the characters are reversed, while a prefix still goes first
+            size_t common = std::min(first.Length(), second.Length());
+            int result = memcmp(first.Characters(), second.Characters(), common);
+            if (result != 0)
+                return result > 0;
+            return first.Length() < second.Length();
+        }
+
+        static bool Lexicographical_Reversed_CaseInsensitive(
+            DynamicStringView first, DynamicStringView second)
+        {
+            return std::lexicographical_compare(
+                first.begin(), first.end(),
+                second.begin(), second.end(),
+                [](char lhs, char rhs) {
+                    return std::tolower(static_cast<unsigned char>(lhs)) > std::tolower(static_cast<unsigned char>(rhs));
+                }
+            );
+        }
+    };
 };
\ No newline at end of file
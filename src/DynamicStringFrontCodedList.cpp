@@ -0,0 +1,184 @@
+#include "DynamicStringFrontCodedList.h"
+
+constexpr size_t DynamicStringFrontCodedList::DEFAULT_RESTART_INTERVAL;
+
+/// @brief Appends a number using 7 bits per byte, so small lengths take a single byte.
+static void WriteVarint(std::vector<char>& bytes, size_t value)
+{
+    while (value >= 0x80)
+    {
+        bytes.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back(static_cast<char>(value));
+}
+
+static const char* ReadVarint(const char* position, size_t& value)
+{
+    value = 0;
+    for (unsigned shift = 0; ; shift += 7)
+    {
+        unsigned char byte = static_cast<unsigned char>(*position++);
+        value |= static_cast<size_t>(byte & 0x7F) << shift;
+        if (byte < 0x80)
+            return position;
+    }
+}
+
+DynamicStringFrontCodedList::DynamicStringFrontCodedList(size_t restartInterval)
+    : restartInterval(restartInterval > 0 ? restartInterval : DEFAULT_RESTART_INTERVAL)
+{ }
+
+bool DynamicStringFrontCodedList::Append(DynamicStringView value)
+{
+    size_t shared = 0;
+    if (count % restartInterval == 0)
+        restartOffsets.push_back(bytes.size());
+    else
+    {
+        size_t limit = last.Length() < value.Length() ? last.Length() : value.Length();
+        while (shared < limit && last[shared] == value[shared])
+            shared++;
+    }
+
+    if (count > 0 && value.Compare(last) < 0)
+        ordered = false;
+
+    size_t suffixLength = value.Length() - shared;
+    WriteVarint(bytes, shared);
+    WriteVarint(bytes, suffixLength);
+    bytes.insert(bytes.end(), value.Characters() + shared, value.Characters() + value.Length());
+
+    last.Truncate(shared);
+    last.Concatenate(value.Characters() + shared, suffixLength);
+
+    if (maxLength < value.Length())
+        maxLength = value.Length();
+    count++;
+    return ordered;
+}
+
+DynamicStringView DynamicStringFrontCodedList::Get(size_t index, DynamicString& buffer) const
+{
+    assert(index < count);
+
+    // decoding from the nearest restart point, where the string is stored completely
+    size_t current = index - index % restartInterval;
+    const char* position = bytes.data() + restartOffsets[index / restartInterval];
+
+    buffer.Reserve(maxLength);
+    buffer.Truncate(0);
+    for (; current <= index; current++)
+        position = DecodeEntry(position, buffer);
+
+    return buffer;
+}
+
+DynamicString DynamicStringFrontCodedList::Get(size_t index) const
+{
+    DynamicString buffer;
+    Get(index, buffer);
+    return buffer;
+}
+
+size_t DynamicStringFrontCodedList::LowerBound(DynamicStringView value) const
+{
+    if (!ordered)
+        return DynamicString::NOT_FOUND;
+
+    // finding the first restart point whose string is greater than the value,
+    // so the result is within the block preceding it
+    size_t low = 0, high = restartOffsets.size();
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (RestartString(middle).Compare(value) <= 0)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    if (low == 0)
+        return 0;
+
+    size_t index = (low - 1) * restartInterval;
+    size_t blockEnd = index + restartInterval < count ? index + restartInterval : count;
+    const char* position = bytes.data() + restartOffsets[low - 1];
+
+    DynamicString buffer(maxLength);
+    for (; index < blockEnd; index++)
+    {
+        position = DecodeEntry(position, buffer);
+        if (DynamicStringView(buffer).Compare(value) >= 0)
+            return index;
+    }
+    return index;
+}
+
+size_t DynamicStringFrontCodedList::Find(DynamicStringView value) const
+{
+    if (!ordered)
+    {
+        size_t index = 0;
+        for (DynamicStringView string : *this)
+        {
+            if (string.Equals(value))
+                return index;
+            index++;
+        }
+        return DynamicString::NOT_FOUND;
+    }
+
+    size_t index = LowerBound(value);
+    if (index < count)
+    {
+        DynamicString buffer;
+        if (Get(index, buffer).Equals(value))
+            return index;
+    }
+    return DynamicString::NOT_FOUND;
+}
+
+void DynamicStringFrontCodedList::Clear()
+{
+    bytes.clear();
+    restartOffsets.clear();
+    last.Truncate(0);
+    count = 0;
+    maxLength = 0;
+    ordered = true;
+}
+
+DynamicStringView DynamicStringFrontCodedList::RestartString(size_t restart) const
+{
+    size_t shared = 0, length = 0;
+    const char* position = ReadVarint(bytes.data() + restartOffsets[restart], shared);
+    position = ReadVarint(position, length);
+    return DynamicStringView(position, length);
+}
+
+const char* DynamicStringFrontCodedList::DecodeEntry(const char* position, DynamicString& buffer)
+{
+    size_t shared = 0, suffixLength = 0;
+    position = ReadVarint(position, shared);
+    position = ReadVarint(position, suffixLength);
+
+    buffer.Truncate(shared);
+    buffer.Concatenate(position, suffixLength);
+    return position + suffixLength;
+}
+
+DynamicStringFrontCodedList::Iterator::Iterator(const DynamicStringFrontCodedList* list, size_t index)
+    : list(list), index(index), position(list->bytes.data())
+{
+    if (index < list->count)
+    {
+        buffer.Reserve(list->maxLength);
+        Decode();
+    }
+}
+
+void DynamicStringFrontCodedList::Iterator::Decode()
+{
+    if (index < list->count)
+        position = DecodeEntry(position, buffer);
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <iterator>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringView.h"
+
+/// @brief Represents a compact read-only list of strings stored with front coding.
+/// Each string is stored as the length of the prefix it shares with the previous
+/// string followed by the rest of its characters, so neighbouring strings of
+/// a sorted list take little more space than their differences.
+///
+/// Every few strings a restart point stores a string completely, which bounds
+/// the work needed to decode a string at any index and allows a binary search
+/// over the restart points.
+class DynamicStringFrontCodedList
+{
+public:
+    /// @brief The default number of strings between two restart points.
+    static constexpr size_t DEFAULT_RESTART_INTERVAL = 16;
+
+public:
+    /// @brief Represents an input iterator decoding the strings sequentially.
+    /// The viewed string is stored in the iterator and stays valid until the
+    /// iterator is advanced or destroyed.
+    class Iterator
+    {
+    public:
+        using value_type = DynamicStringView;
+        using pointer = const DynamicStringView*;
+        using reference = DynamicStringView;
+        using iterator_category = std::input_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+
+    public:
+        Iterator& operator++()
+        {
+            index++;
+            Decode();
+            return *this;
+        }
+
+        /// @brief Advances the iterator, returning a copy of it at the string it
+        /// pointed to; the copy keeps the decoded string in its own buffer.
+        Iterator operator++(int)
+        {
+            Iterator iterator = *this;
+            ++(*this);
+            return iterator;
+        }
+
+        DynamicStringView operator*() const { return buffer; }
+
+        bool operator==(const Iterator& other) const { return index == other.index; }
+
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    private:
+        friend class DynamicStringFrontCodedList;
+
+        Iterator(const DynamicStringFrontCodedList* list, size_t index);
+
+        /// @brief Decodes the string at the current index into the buffer.
+        void Decode();
+
+    private:
+        const DynamicStringFrontCodedList* list;
+        size_t index;
+        const char* position;
+        DynamicString buffer;
+    };
+
+public:
+    /// @brief Constructor that creates an empty list.
+    /// @param restartInterval The number of strings between two restart points;
+    /// longer intervals save more space but make random access slower.
+    explicit DynamicStringFrontCodedList(size_t restartInterval = DEFAULT_RESTART_INTERVAL);
+
+public:
+    /// @brief Appends the viewed string to the end of the list. A string going
+    /// before the last one is appended as well, but the list stops being ordered.
+    /// @param value The string to be appended.
+    /// @return true if the list is still in lexicographical order.
+    bool Append(DynamicStringView value);
+
+    /// @brief Decodes the string at the specified index into a reused buffer.
+    /// @param index The index of the string.
+    /// @param buffer The string receiving the characters; its capacity is reused.
+    /// @return A view of the buffer.
+    DynamicStringView Get(size_t index, DynamicString& buffer) const;
+
+    /// @brief Decodes the string at the specified index.
+    /// @param index The index of the string.
+    /// @return The decoded string.
+    DynamicString Get(size_t index) const;
+
+    /// @brief Returns the index of the first string that is not lexicographically
+    /// less than the viewed one. The strings must be appended in lexicographical order.
+    /// @param value The string to compare with.
+    /// @return The index of the first string not less than the value or Size() if there is none,
+    /// or DynamicString::NOT_FOUND if the list is not ordered.
+    size_t LowerBound(DynamicStringView value) const;
+
+    /// @brief Returns the index of the string equal to the viewed one. The strings
+    /// of an ordered list are searched for with a binary search, while those
+    /// of an unordered list are decoded one by one.
+    /// @param value The string to look for.
+    /// @return The index of the string or DynamicString::NOT_FOUND if there is none.
+    size_t Find(DynamicStringView value) const;
+
+    /// @brief Removes all the strings from the list.
+    void Clear();
+
+    /// @brief Returns the number of strings in the list.
+    /// @return The number of strings in the list.
+    size_t Size() const { return count; }
+
+    /// @brief Returns the number of bytes taken by the encoded strings and restart points.
+    /// @return The number of bytes taken by the encoded strings and restart points.
+    size_t EncodedSize() const { return bytes.size() + restartOffsets.size() * sizeof(size_t); }
+
+    /// @brief Returns a value indicating whether the strings have been appended
+    /// in lexicographical order, as the searches require.
+    /// @return true if the strings are in lexicographical order.
+    bool IsOrdered() const { return ordered; }
+
+    /// @brief Returns an iterator decoding the strings from the first one.
+    /// @return An iterator to the first string.
+    Iterator begin() const { return Iterator(this, 0); }
+
+    /// @brief Returns an iterator one past the last string.
+    /// @return An iterator one past the last string.
+    Iterator end() const { return Iterator(this, count); }
+
+private:
+    /// @brief Returns a view of the string stored completely at the specified restart point.
+    DynamicStringView RestartString(size_t restart) const;
+
+    /// @brief Decodes the entry at the position into the buffer holding the previous string.
+    /// @return The position of the next entry.
+    static const char* DecodeEntry(const char* position, DynamicString& buffer);
+
+private:
+    size_t restartInterval;
+    size_t count = 0;
+    size_t maxLength = 0;
+    bool ordered = true;
+
+    std::vector<char> bytes;
+    std::vector<size_t> restartOffsets;
+
+    // the last appended string, against which the next one is coded
+    DynamicString last;
+};
@@ -0,0 +1,167 @@
+#include "DynamicStringInterner.h"
+
+#include <algorithm>
+#include <new>
+
+constexpr size_t DynamicStringInterner::ARENA_BLOCK_SIZE;
+
+DynamicStringInterner::DynamicStringInterner(size_t expectedCount)
+{
+    static std::atomic<uint64_t> nextId { 1 };
+    id = nextId.fetch_add(1, std::memory_order_relaxed);
+
+    // keeping the load factor at most one half to keep probe sequences short
+    size_t slotCount = 2;
+    while (slotCount < 2 * expectedCount)
+        slotCount *= 2;
+
+    slots = new std::atomic<const Entry*>[slotCount];
+    for (size_t i = 0; i < slotCount; i++)
+        slots[i].store(nullptr, std::memory_order_relaxed);
+    slotMask = slotCount - 1;
+}
+
+DynamicStringInterner::~DynamicStringInterner()
+{
+    delete[] slots;
+    for (Arena* arena : arenas)
+        delete arena;
+}
+
+DynamicStringInterner::Handle DynamicStringInterner::Intern(DynamicStringView value)
+{
+    uint64_t hash = value.Hash();
+    Entry* entry = nullptr;
+    Arena* arena = nullptr;
+
+    for (size_t probe = 0, slot = hash & slotMask; probe <= slotMask; probe++, slot = (slot + 1) & slotMask)
+    {
+        const Entry* current = slots[slot].load(std::memory_order_acquire);
+        if (!current)
+        {
+            if (!entry)
+            {
+                // the entry is completely written before it is published
+                arena = &LocalArena();
+                entry = new (arena->Allocate(EntrySize(value.Length()))) Entry { hash, value.Length() };
+                char* characters = reinterpret_cast<char*>(entry + 1);
+                memcpy(characters, value.Characters(), value.Length());
+                characters[value.Length()] = '\0';
+            }
+
+            if (slots[slot].compare_exchange_strong(current, entry,
+                std::memory_order_release, std::memory_order_acquire))
+            {
+                arena->count.fetch_add(1, std::memory_order_relaxed);
+                return Handle(entry);
+            }
+            // another thread has just claimed the slot, so its entry is checked below
+        }
+
+        if (current->hash == hash && current->length == value.Length() &&
+            memcmp(current->Characters(), value.Characters(), value.Length()) == 0)
+        {
+            if (entry)
+                arena->Release(reinterpret_cast<char*>(entry), EntrySize(value.Length()));
+            return Handle(current);
+        }
+    }
+
+    if (entry)
+        arena->Release(reinterpret_cast<char*>(entry), EntrySize(value.Length()));
+    return Handle();
+}
+
+DynamicStringInterner::Handle DynamicStringInterner::Find(DynamicStringView value) const
+{
+    uint64_t hash = value.Hash();
+
+    for (size_t probe = 0, slot = hash & slotMask; probe <= slotMask; probe++, slot = (slot + 1) & slotMask)
+    {
+        const Entry* current = slots[slot].load(std::memory_order_acquire);
+        if (!current)
+            return Handle();
+
+        if (current->hash == hash && current->length == value.Length() &&
+            memcmp(current->Characters(), value.Characters(), value.Length()) == 0)
+            return Handle(current);
+    }
+    return Handle();
+}
+
+size_t DynamicStringInterner::Size() const
+{
+    std::lock_guard<std::mutex> lock(arenasMutex);
+    size_t size = 0;
+    for (const Arena* arena : arenas)
+        size += arena->count.load(std::memory_order_relaxed);
+    return size;
+}
+
+DynamicStringInterner::Arena& DynamicStringInterner::LocalArena()
+{
+    struct CachedArena
+    {
+        uint64_t tableId;
+        std::weak_ptr<char> tableLifetime;
+        Arena* arena;
+    };
+    // entries of destroyed tables are never matched since ids are not reused,
+    // and they are dropped whenever a table is not found, so the cache only
+    // grows with the number of tables alive
+    thread_local std::vector<CachedArena> cache;
+
+    for (const CachedArena& cached : cache)
+        if (cached.tableId == id)
+            return *cached.arena;
+
+    cache.erase(std::remove_if(cache.begin(), cache.end(),
+        [](const CachedArena& cached) { return cached.tableLifetime.expired(); }), cache.end());
+
+    Arena* arena = new Arena;
+    {
+        std::lock_guard<std::mutex> lock(arenasMutex);
+        arenas.push_back(arena);
+    }
+    cache.push_back(CachedArena { id, lifetime, arena });
+    return *arena;
+}
+
+size_t DynamicStringInterner::EntrySize(size_t length)
+{
+    // rounding up to keep the next entry aligned
+    size_t size = sizeof(Entry) + length + 1;
+    return (size + alignof(Entry) - 1) & ~(alignof(Entry) - 1);
+}
+
+DynamicStringInterner::Arena::~Arena()
+{
+    for (char* block : blocks)
+        delete[] block;
+}
+
+char* DynamicStringInterner::Arena::Allocate(size_t size)
+{
+    if (size > remaining)
+    {
+        size_t blockSize = std::max(size, ARENA_BLOCK_SIZE);
+        current = new char[blockSize];
+        remaining = blockSize;
+        blocks.push_back(current);
+    }
+
+    char* allocation = current;
+    current += size;
+    remaining -= size;
+    return allocation;
+}
+
+void DynamicStringInterner::Arena::Release(char* allocation, size_t size)
+{
+    // only the latest allocation can be given back
+    if (allocation + size == current)
+    {
+        current = allocation;
+        remaining += size;
+    }
+}
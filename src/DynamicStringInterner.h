@@ -0,0 +1,148 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "DynamicStringView.h"
+
+/// @brief Represents a table of unique strings that can be shared between threads.
+/// Interning equal character sequences yields the same handle, so interned
+/// strings can be compared by handle instead of by characters.
+///
+/// The table is a lock-free open addressing hash table of a fixed number of slots:
+/// a slot is claimed with a single compare-and-swap, while the characters are
+/// copied beforehand into an arena owned by the inserting thread, so threads
+/// never wait for each other. Lookups only read the slots and finish in a
+/// bounded number of steps even while other threads insert.
+class DynamicStringInterner
+{
+private:
+    struct Entry
+    {
+        uint64_t hash;
+        size_t length;
+
+        const char* Characters() const { return reinterpret_cast<const char*>(this + 1); }
+    };
+
+public:
+    /// @brief Represents a stable reference to an interned string. The referenced
+    /// characters are null-terminated and live as long as the table itself.
+    class Handle
+    {
+    public:
+        /// @brief Default constructor that creates an invalid handle.
+        Handle() = default;
+
+        /// @brief Returns a value indicating whether the handle references a string.
+        /// @return true if the handle references a string.
+        bool IsValid() const { return entry != nullptr; }
+
+        /// @brief Returns a view of the interned characters.
+        /// @return A view of the interned characters or an empty view if invalid.
+        DynamicStringView View() const
+        {
+            return entry ? DynamicStringView(entry->Characters(), entry->length) : DynamicStringView();
+        }
+
+        /// @brief Returns the hash of the interned characters.
+        /// @return The hash of the interned characters.
+        uint64_t Hash() const { return entry ? entry->hash : DynamicStringView().Hash(); }
+
+        /// @brief Converts the handle to a view of the interned characters.
+        operator DynamicStringView() const { return View(); }
+
+        bool operator==(Handle other) const { return entry == other.entry; }
+
+        bool operator!=(Handle other) const { return entry != other.entry; }
+
+    private:
+        friend class DynamicStringInterner;
+
+        explicit Handle(const Entry* entry) : entry(entry) { }
+
+    private:
+        const Entry* entry = nullptr;
+    };
+
+public:
+    /// @brief Constructor that creates an empty table with twice as many slots
+    /// as the expected number of strings, rounded up to a power of two.
+    /// The table never grows, so the expected number should not be exceeded much.
+    /// @param expectedCount The expected number of distinct strings.
+    DynamicStringInterner(size_t expectedCount);
+
+    DynamicStringInterner(const DynamicStringInterner& other) = delete;
+
+    DynamicStringInterner& operator=(const DynamicStringInterner& other) = delete;
+
+    /// @brief Destroy the table and all the interned strings.
+    /// No thread may use the table or its handles at that point.
+    ~DynamicStringInterner();
+
+public:
+    /// @brief Returns the handle of the string equal to the specified characters,
+    /// interning a copy of them first if there is no such string yet.
+    /// Safe to call from any number of threads at once.
+    /// @param value The characters to be interned.
+    /// @return The handle of the interned string or an invalid handle if the table is full.
+    Handle Intern(DynamicStringView value);
+
+    /// @brief Returns the handle of the string equal to the specified characters
+    /// without interning them. Safe to call while other threads intern strings.
+    /// @param value The characters to be found.
+    /// @return The handle of the interned string or an invalid handle if there is none.
+    Handle Find(DynamicStringView value) const;
+
+    /// @brief Returns the number of distinct strings interned so far.
+    /// While other threads intern strings, the result is approximate.
+    /// @return The number of distinct strings interned so far.
+    size_t Size() const;
+
+    /// @brief Returns the number of slots, i.e. the maximum number of distinct strings.
+    /// @return The number of slots of the table.
+    size_t Capacity() const { return slotMask + 1; }
+
+private:
+    /// @brief Represents a bump allocator for the entries of a single thread.
+    struct Arena
+    {
+        std::vector<char*> blocks;
+        char* current = nullptr;
+        size_t remaining = 0;
+        // written by the owning thread only, read by Size()
+        std::atomic<size_t> count { 0 };
+
+        ~Arena();
+
+        char* Allocate(size_t size);
+        void Release(char* allocation, size_t size);
+    };
+
+    /// @brief Returns the arena of the calling thread, creating it on first use.
+    /// @return The arena of the calling thread.
+    Arena& LocalArena();
+
+    /// @brief Returns the number of bytes an entry with the specified length takes.
+    static size_t EntrySize(size_t length);
+
+private:
+    static constexpr size_t ARENA_BLOCK_SIZE = 64 * 1024;
+
+    std::atomic<const Entry*>* slots;
+    size_t slotMask;
+
+    // identifies the table in the thread-local arena caches,
+    // unlike the address it is never reused by another table
+    uint64_t id;
+
+    // expires when the table is destroyed, so the thread-local
+    // caches can drop the arenas of destroyed tables
+    std::shared_ptr<char> lifetime = std::make_shared<char>();
+
+    mutable std::mutex arenasMutex;
+    std::vector<Arena*> arenas;
+};
@@ -0,0 +1,175 @@
+#include "DynamicStringMatcher.h"
+
+#include <algorithm>
+#include <cctype>
+#include <thread>
+
+DynamicStringMatcher::DynamicStringMatcher(const std::vector<DynamicString>& patterns, bool caseInsensitive)
+{
+    auto fold = [caseInsensitive](unsigned char byte) {
+        return caseInsensitive ? static_cast<unsigned char>(std::tolower(byte)) : byte;
+    };
+
+    // every byte occurring in a pattern gets its own class,
+    // the rest of them share the class zero
+    uint16_t patternClasses[256] = { 0 };
+    classCount = 1;
+    for (const DynamicString& pattern : patterns)
+        for (char character : DynamicStringView(pattern))
+        {
+            unsigned char byte = fold(static_cast<unsigned char>(character));
+            if (patternClasses[byte] == 0)
+                patternClasses[byte] = static_cast<uint16_t>(classCount++);
+        }
+    for (int byte = 0; byte < 256; byte++)
+        byteClasses[byte] = patternClasses[fold(static_cast<unsigned char>(byte))];
+
+    // building the trie, missing transitions are marked as NONE
+    const uint32_t NONE = UINT32_MAX;
+    transitions.assign(classCount, NONE);
+    std::vector<std::vector<uint32_t>> outputs(1);
+
+    for (size_t index = 0; index < patterns.size(); index++)
+    {
+        DynamicStringView pattern = patterns[index];
+        patternLengths.push_back(pattern.Length());
+        if (pattern.IsEmpty()) continue;
+
+        uint32_t state = 0;
+        for (char character : pattern)
+        {
+            uint32_t& next = transitions[state * classCount + byteClasses[static_cast<unsigned char>(character)]];
+            if (next == NONE)
+            {
+                next = static_cast<uint32_t>(outputs.size());
+                outputs.emplace_back();
+                transitions.resize(transitions.size() + classCount, NONE);
+            }
+            // the reference may be invalidated by the resize above
+            state = transitions[state * classCount + byteClasses[static_cast<unsigned char>(character)]];
+        }
+        outputs[state].push_back(static_cast<uint32_t>(index));
+    }
+
+    // resolving failure links in breadth-first order, so the failure state
+    // of every state is complete by the time the state itself is visited
+    size_t stateCount = outputs.size();
+    std::vector<uint32_t> failures(stateCount, 0);
+    std::vector<uint32_t> queue;
+    queue.reserve(stateCount);
+
+    for (size_t column = 0; column < classCount; column++)
+    {
+        uint32_t& next = transitions[column];
+        if (next == NONE)
+            next = 0;
+        else
+            queue.push_back(next);
+    }
+
+    for (size_t head = 0; head < queue.size(); head++)
+    {
+        uint32_t state = queue[head];
+        const uint32_t* failureRow = &transitions[failures[state] * classCount];
+        uint32_t* row = &transitions[state * classCount];
+
+        // patterns ending at the failure state also end here
+        const std::vector<uint32_t>& inherited = outputs[failures[state]];
+        outputs[state].insert(outputs[state].end(), inherited.begin(), inherited.end());
+
+        for (size_t column = 0; column < classCount; column++)
+        {
+            if (row[column] == NONE)
+                row[column] = failureRow[column];
+            else
+            {
+                failures[row[column]] = failureRow[column];
+                queue.push_back(row[column]);
+            }
+        }
+    }
+
+    outputOffsets.reserve(stateCount + 1);
+    outputOffsets.push_back(0);
+    for (std::vector<uint32_t>& output : outputs)
+    {
+        // the longest pattern is reported first
+        std::stable_sort(output.begin(), output.end(), [this](uint32_t lhs, uint32_t rhs) {
+            return patternLengths[lhs] > patternLengths[rhs];
+        });
+        outputPatterns.insert(outputPatterns.end(), output.begin(), output.end());
+        outputOffsets.push_back(static_cast<uint32_t>(outputPatterns.size()));
+    }
+}
+
+std::vector<DynamicStringMatcher::Match> DynamicStringMatcher::FindAll(DynamicStringView text) const
+{
+    std::vector<Match> matches;
+    Scan(text, false, matches);
+    return matches;
+}
+
+DynamicStringMatcher::Match DynamicStringMatcher::FindFirst(DynamicStringView text) const
+{
+    std::vector<Match> matches;
+    Scan(text, true, matches);
+    if (matches.empty())
+        return Match { DynamicString::NOT_FOUND, DynamicString::NOT_FOUND };
+    return matches.front();
+}
+
+std::vector<std::vector<DynamicStringMatcher::Match>> DynamicStringMatcher::FindAll(
+    const std::vector<DynamicString>& texts, size_t threadCount) const
+{
+    std::vector<std::vector<Match>> results(texts.size());
+
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, texts.size());
+
+    // every thread scans its own contiguous slice of texts and
+    // writes only to the result slots of that slice
+    auto scanSlice = [&](size_t begin, size_t end) {
+        for (size_t index = begin; index < end; index++)
+            Scan(texts[index], false, results[index]);
+    };
+
+    if (threadCount <= 1)
+    {
+        scanSlice(0, texts.size());
+        return results;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    size_t sliceLength = (texts.size() + threadCount - 1) / threadCount;
+    for (size_t begin = 0; begin < texts.size(); begin += sliceLength)
+        threads.emplace_back(scanSlice, begin, std::min(begin + sliceLength, texts.size()));
+    for (std::thread& thread : threads)
+        thread.join();
+
+    return results;
+}
+
+void DynamicStringMatcher::Scan(DynamicStringView text, bool firstOnly, std::vector<Match>& matches) const
+{
+    const unsigned char* characters = reinterpret_cast<const unsigned char*>(text.Characters());
+    const uint32_t* table = transitions.data();
+    uint32_t state = 0;
+
+    for (size_t index = 0; index < text.Length(); index++)
+    {
+        state = table[state * classCount + byteClasses[characters[index]]];
+
+        uint32_t begin = outputOffsets[state];
+        uint32_t end = outputOffsets[state + 1];
+        if (begin == end) continue;
+
+        for (uint32_t output = begin; output < end; output++)
+        {
+            uint32_t pattern = outputPatterns[output];
+            matches.push_back(Match { pattern, index + 1 - patternLengths[pattern] });
+            if (firstOnly) return;
+        }
+    }
+}
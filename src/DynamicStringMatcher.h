@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "DynamicString.h"
+
+/// @brief Represents a multi-pattern matcher that finds occurrences of many
+/// patterns in a single pass over the characters (the Aho-Corasick automaton).
+/// The transition table is compressed by byte classes: all the bytes that do not
+/// occur in any pattern share one column, so a table row only has as many
+/// entries as there are distinct pattern characters plus one.
+class DynamicStringMatcher
+{
+public:
+    /// @brief Represents a single occurrence of a pattern.
+    struct Match
+    {
+        /// @brief The index of the pattern that matched.
+        size_t pattern;
+
+        /// @brief The index of the first matched character within the text.
+        size_t position;
+    };
+
+public:
+    /// @brief Constructor that compiles the automaton for the specified patterns.
+    /// Empty patterns are kept for their indices but never match.
+    /// @param patterns The character sequences to be searched for.
+    /// @param caseInsensitive Whether characters are compared case insensitive
+    /// the same way DynamicStringComparator compares them.
+    DynamicStringMatcher(const std::vector<DynamicString>& patterns, bool caseInsensitive = false);
+
+public:
+    /// @brief Finds all the occurrences of all the patterns, including overlapping ones.
+    /// Matches are reported in the order of their last character.
+    /// @param text The characters to search in.
+    /// @return All the matches found.
+    std::vector<Match> FindAll(DynamicStringView text) const;
+
+    /// @brief Finds the occurrence that ends first in the text. If several patterns
+    /// end at the same character, the longest of them is reported.
+    /// @param text The characters to search in.
+    /// @return The match found; its position is DynamicString::NOT_FOUND if there is none.
+    Match FindFirst(DynamicStringView text) const;
+
+    /// @brief Finds all the occurrences of all the patterns in each of the texts,
+    /// splitting the texts between the specified number of threads.
+    /// @param texts The strings to search in.
+    /// @param threadCount The number of threads to use; zero uses one per hardware thread.
+    /// @return The matches found for each text, in the order of the texts.
+    std::vector<std::vector<Match>> FindAll(
+        const std::vector<DynamicString>& texts, size_t threadCount = 0) const;
+
+    /// @brief Returns the number of patterns compiled into the matcher.
+    /// @return The number of patterns compiled into the matcher.
+    size_t PatternCount() const { return patternLengths.size(); }
+
+    /// @brief Returns the number of states of the automaton.
+    /// @return The number of states of the automaton.
+    size_t StateCount() const { return outputOffsets.size() - 1; }
+
+private:
+    /// @brief Runs the automaton over the text, appending every match found
+    /// or stopping after the first one.
+    /// @param text The characters to search in.
+    /// @param firstOnly Whether to stop at the first character some pattern ends at.
+    /// @param matches The matches to append to.
+    void Scan(DynamicStringView text, bool firstOnly, std::vector<Match>& matches) const;
+
+private:
+    // column of the transition table for each byte value
+    uint16_t byteClasses[256];
+    size_t classCount;
+
+    // classCount entries per state, all the transitions are resolved
+    std::vector<uint32_t> transitions;
+
+    // patterns ending at state s are outputPatterns[outputOffsets[s]..outputOffsets[s+1])
+    std::vector<uint32_t> outputOffsets;
+    std::vector<uint32_t> outputPatterns;
+
+    std::vector<size_t> patternLengths;
+};
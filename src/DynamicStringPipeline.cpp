@@ -0,0 +1,277 @@
+#include "DynamicStringPipeline.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+
+#include "DynamicStringBuilder.h"
+#include "DynamicStringQueue.h"
+#include "DynamicStringTransform.h"
+
+#ifdef DYNSTR_HAS_IOVEC
+#include <cerrno>
+#include <unistd.h>
+#else
+#include <io.h>
+#endif
+
+constexpr int DynamicStringPipeline::STANDARD_INPUT;
+constexpr size_t DynamicStringPipeline::DEFAULT_CHUNK_CAPACITY;
+constexpr size_t DynamicStringPipeline::BATCH_CAPACITY;
+constexpr size_t DynamicStringPipeline::QUEUE_CAPACITY;
+
+DynamicStringPipeline::DynamicStringPipeline(Comparator comparator,
+    DynamicStringSorter::Options options, size_t chunkCapacity)
+    : comparator(comparator), options(options),
+    chunkCapacity(chunkCapacity > 0 ? chunkCapacity : DEFAULT_CHUNK_CAPACITY)
+{
+    if (this->options.count)
+        this->options.unique = true;
+}
+
+DynamicStringPipeline::~DynamicStringPipeline()
+{
+    for (Chunk* chunk : chunks)
+        delete chunk;
+}
+
+bool DynamicStringPipeline::ReadFrom(int fileDescriptor)
+{
+    DynamicStringQueue<Chunk*> unsorted(QUEUE_CAPACITY);
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < std::max<size_t>(options.threads, 1); i++)
+    {
+        workers.emplace_back([this, &unsorted] {
+            Chunk* chunk = nullptr;
+            while (unsorted.Pop(chunk))
+                SortChunk(*chunk);
+        });
+    }
+
+    bool good = true;
+    bool finished = false;
+
+    // the incomplete line at the end of a chunk is carried over to the next one;
+    // the characters of a chunk are never changed while its lines are being sorted
+    const char* carried = nullptr;
+    size_t carriedLength = 0;
+
+    while (!finished)
+    {
+        Chunk* chunk = new Chunk(std::max(chunkCapacity, 2 * carriedLength));
+        if (carriedLength > 0)
+            memcpy(chunk->characters, carried, carriedLength);
+        chunk->length = carriedLength;
+
+        size_t lineStart = 0, scanned = 0;
+        while (true)
+        {
+            const char* newLine;
+            while ((newLine = static_cast<const char*>(
+                memchr(chunk->characters + scanned, '\n', chunk->length - scanned))) != nullptr)
+            {
+                size_t lineEnd = newLine - chunk->characters;
+                // an empty line ends the input, just like in the sequential mode
+                if (lineEnd == lineStart)
+                {
+                    finished = true;
+                    break;
+                }
+
+                DynamicStringView line(chunk->characters + lineStart, lineEnd - lineStart);
+                chunk->lines.push_back(Line { line, line, 1 });
+                lineStart = scanned = lineEnd + 1;
+            }
+            if (finished)
+                break;
+            scanned = chunk->length;
+
+            if (chunk->length == chunk->capacity)
+            {
+                if (lineStart > 0)
+                    break;
+
+                // a line longer than the chunk: no views point into it yet, so it can be moved
+                char* grown = new char[2 * chunk->capacity];
+                memcpy(grown, chunk->characters, chunk->length);
+                delete[] chunk->characters;
+                chunk->characters = grown;
+                chunk->capacity *= 2;
+            }
+
+            long read = ReadSome(fileDescriptor, chunk->characters + chunk->length, chunk->capacity - chunk->length);
+            if (read <= 0)
+            {
+                // the last line may lack its new-line character
+                if (chunk->length > lineStart)
+                {
+                    DynamicStringView line(chunk->characters + lineStart, chunk->length - lineStart);
+                    chunk->lines.push_back(Line { line, line, 1 });
+                }
+                good = read == 0;
+                finished = true;
+                break;
+            }
+            chunk->length += static_cast<size_t>(read);
+        }
+
+        carried = chunk->characters + lineStart;
+        carriedLength = finished ? 0 : chunk->length - lineStart;
+        lineCount += chunk->lines.size();
+
+        chunks.push_back(chunk);
+        if (!chunk->lines.empty())
+            unsorted.Push(chunk);
+    }
+
+    unsorted.Close();
+    for (std::thread& worker : workers)
+        worker.join();
+    return good;
+}
+
+void DynamicStringPipeline::WriteTo(DynamicStringWriter& writer)
+{
+    // the batches circulate between the merging and the writing threads
+    DynamicStringQueue<DynamicStringBuilder*> filled(QUEUE_CAPACITY), emptied(QUEUE_CAPACITY);
+    for (size_t i = 0; i < QUEUE_CAPACITY; i++)
+        emptied.Push(new DynamicStringBuilder(BATCH_CAPACITY));
+
+    std::thread writing([&filled, &emptied, &writer] {
+        DynamicStringBuilder* batch = nullptr;
+        while (filled.Pop(batch))
+        {
+            writer.Write(*batch);
+            batch->Clear();
+            emptied.Push(batch);
+        }
+    });
+
+    struct Cursor
+    {
+        const Line* current;
+        const Line* end;
+    };
+    std::vector<Cursor> cursors;
+    for (const Chunk* chunk : chunks)
+        if (!chunk->lines.empty())
+            cursors.push_back(Cursor { chunk->lines.data(), chunk->lines.data() + chunk->lines.size() });
+
+    // the heap keeps the cursor at the first line of all at the front
+    auto follows = [this](const Cursor& first, const Cursor& second) {
+        return Precedes(*second.current, *first.current);
+    };
+    std::make_heap(cursors.begin(), cursors.end(), follows);
+
+    DynamicStringBuilder* batch = nullptr;
+    emptied.Pop(batch);
+    size_t written = 0;
+    auto emit = [&](const Line& line) {
+        if (options.count)
+        {
+            char prefix[32];
+            int length = snprintf(prefix, sizeof(prefix), "%7llu ",
+                static_cast<unsigned long long>(line.count));
+            batch->Append(DynamicStringView(prefix, length));
+        }
+        batch->Append(line.string).Append('\n');
+        written++;
+
+        if (batch->Length() >= BATCH_CAPACITY)
+        {
+            filled.Push(batch);
+            emptied.Pop(batch);
+        }
+    };
+
+    // a line is emitted once the next one differs, so equal lines of different chunks are merged
+    Line pending { DynamicStringView(), DynamicStringView(), 0 };
+    bool hasPending = false;
+    while (!cursors.empty() && (options.top == 0 || written < options.top))
+    {
+        std::pop_heap(cursors.begin(), cursors.end(), follows);
+        Cursor& cursor = cursors.back();
+        Line line = *cursor.current;
+        if (++cursor.current == cursor.end)
+            cursors.pop_back();
+        else
+            std::push_heap(cursors.begin(), cursors.end(), follows);
+
+        if (options.unique && hasPending && pending.string == line.string)
+        {
+            pending.count += line.count;
+            continue;
+        }
+        if (hasPending)
+            emit(pending);
+        pending = line;
+        hasPending = true;
+    }
+    if (hasPending && (options.top == 0 || written < options.top))
+        emit(pending);
+
+    filled.Push(batch);
+    filled.Close();
+    writing.join();
+
+    while (emptied.TryPop(batch))
+        delete batch;
+}
+
+void DynamicStringPipeline::SortChunk(Chunk& chunk) const
+{
+    auto precedes = [this](const Line& first, const Line& second) { return Precedes(first, second); };
+    std::vector<Line>& lines = chunk.lines;
+
+    // the keys are converted into a buffer of their own, as the lines are written
+    // as they are; only the characters of the lines are read, since the carried
+    // incomplete line past them is being copied into the next chunk meanwhile
+    if (options.fold)
+    {
+        const Line& last = lines.back();
+        size_t linesLength = last.string.Characters() + last.string.Length() - chunk.characters;
+        chunk.folded = new char[linesLength];
+        DynamicStringTransform::ToLower(chunk.characters, linesLength, chunk.folded);
+        for (Line& line : lines)
+            line.key = DynamicStringView(chunk.folded + (line.string.Characters() - chunk.characters), line.string.Length());
+    }
+
+    // lines past the top ones of a chunk cannot be among the top ones of all chunks
+    if (options.top > 0 && !options.unique && options.top < lines.size())
+    {
+        std::partial_sort(lines.begin(), lines.begin() + options.top, lines.end(), precedes);
+        lines.erase(lines.begin() + options.top, lines.end());
+        return;
+    }
+
+    std::sort(lines.begin(), lines.end(), precedes);
+    if (options.unique)
+    {
+        size_t kept = 0;
+        for (size_t i = 0; i < lines.size(); i++)
+        {
+            if (kept > 0 && lines[kept - 1].string == lines[i].string)
+                lines[kept - 1].count += lines[i].count;
+            else
+                lines[kept++] = lines[i];
+        }
+        lines.erase(lines.begin() + kept, lines.end());
+    }
+
+    if (options.top > 0 && options.top < lines.size())
+        lines.erase(lines.begin() + options.top, lines.end());
+}
+
+long DynamicStringPipeline::ReadSome(int fileDescriptor, char* buffer, size_t size)
+{
+#ifdef DYNSTR_HAS_IOVEC
+    while (true)
+    {
+        ssize_t count = read(fileDescriptor, buffer, size);
+        if (count >= 0 || errno != EINTR)
+            return static_cast<long>(count);
+    }
+#else
+    return _read(fileDescriptor, buffer, static_cast<unsigned>(size));
+#endif
+}
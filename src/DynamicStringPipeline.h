@@ -0,0 +1,127 @@
+#pragma once
+
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringSorter.h"
+#include "DynamicStringView.h"
+#include "DynamicStringWriter.h"
+
+/// @brief Represents the pipelined mode of the dynstr program. While the input
+/// is being read into large chunks, worker threads sort the chunks read so far,
+/// so reading and sorting overlap. The sorted chunks are then merged, and the
+/// merged lines are written by another thread, so merging and writing overlap too.
+/// The stages are connected by bounded lock-free queues (DynamicStringQueue).
+///
+/// Lines are never copied into strings of their own: they stay in the chunks
+/// they have been read into, and only views of them are sorted and merged.
+class DynamicStringPipeline
+{
+public:
+    using Comparator = bool (*)(DynamicStringView, DynamicStringView);
+
+    /// @brief The file descriptor of the standard input.
+    static constexpr int STANDARD_INPUT = 0;
+
+public:
+    /// @brief Constructor that creates an empty pipeline.
+    /// @param comparator The function telling whether a line goes before another one.
+    /// @param options The options of the sorting stage; threads is the number of sorting threads.
+    /// @param chunkCapacity The number of characters read into each chunk.
+    DynamicStringPipeline(Comparator comparator, DynamicStringSorter::Options options,
+        size_t chunkCapacity = DEFAULT_CHUNK_CAPACITY);
+
+    DynamicStringPipeline(const DynamicStringPipeline& other) = delete;
+
+    DynamicStringPipeline& operator=(const DynamicStringPipeline& other) = delete;
+
+    /// @brief Destroy the pipeline and all the chunks read.
+    ~DynamicStringPipeline();
+
+public:
+    /// @brief Reads lines from the file descriptor up to an empty line or the end
+    /// of the input, handing every chunk read over to the sorting threads.
+    /// Returns when all the chunks are sorted.
+    /// @param fileDescriptor The file descriptor to read from; it is not closed.
+    /// @return true if no read has failed.
+    bool ReadFrom(int fileDescriptor);
+
+    /// @brief Merges the sorted chunks and writes the lines one per line
+    /// on a separate thread, like DynamicStringSorter::WriteTo() does.
+    /// @param writer The writer to write the lines to.
+    void WriteTo(DynamicStringWriter& writer);
+
+    /// @brief Returns the number of lines read.
+    /// @return The number of lines read.
+    size_t Size() const { return lineCount; }
+
+private:
+    struct Line
+    {
+        DynamicStringView string;
+
+        // the characters the line is compared by: the line itself,
+        // or its characters in lower case with the fold option
+        DynamicStringView key;
+        size_t count;
+    };
+
+    struct Chunk
+    {
+        explicit Chunk(size_t capacity)
+            : characters(new char[capacity]), capacity(capacity)
+        { }
+
+        ~Chunk()
+        {
+            delete[] characters;
+            delete[] folded;
+        }
+
+        char* characters;
+        size_t capacity;
+        size_t length = 0;
+        std::vector<Line> lines;
+
+        // the keys of the lines with the fold option
+        char* folded = nullptr;
+    };
+
+    /// @brief Returns a value indicating whether the first line goes before the second one.
+    /// In the unique mode and with the fold option equivalent lines are ordered by
+    /// their keys and then by their characters, like DynamicStringSorter orders
+    /// them, so equal lines are always next to each other.
+    bool Precedes(const Line& first, const Line& second) const
+    {
+        if (!options.unique && !options.fold)
+            return comparator(first.string, second.string);
+
+        if (comparator(first.key, second.key))
+            return true;
+        if (comparator(second.key, first.key))
+            return false;
+        if (first.key != second.key)
+            return first.key < second.key;
+        return first.string < second.string;
+    }
+
+    /// @brief Sorts the lines of the chunk, merging equal lines and dropping
+    /// the lines past the top ones as the options require.
+    void SortChunk(Chunk& chunk) const;
+
+    /// @brief Reads up to the specified number of characters, retrying interrupted reads.
+    /// @return The number of characters read, zero at the end of the input, or a negative number on failure.
+    static long ReadSome(int fileDescriptor, char* buffer, size_t size);
+
+private:
+    static constexpr size_t DEFAULT_CHUNK_CAPACITY = 1024 * 1024;
+    static constexpr size_t BATCH_CAPACITY = 64 * 1024;
+    static constexpr size_t QUEUE_CAPACITY = 8;
+
+    Comparator comparator;
+    DynamicStringSorter::Options options;
+    size_t chunkCapacity;
+
+    std::vector<Chunk*> chunks;
+    size_t lineCount = 0;
+};
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+/// @brief Represents a bounded lock-free queue connecting the stages of a pipeline.
+/// Any number of threads may push and pop values concurrently: every cell of
+/// the ring carries a sequence number telling whether it is ready to be written
+/// or read, so threads only contend on advancing the positions with a CAS.
+///
+/// Push() and Pop() wait by yielding for a while when the queue is full or empty,
+/// and then sleep on a condition variable until a value is pushed or popped, so
+/// threads waiting for slow input do not keep their cores busy. The mutex is only
+/// taken when some thread sleeps. Once the producers are done, Close() wakes the
+/// consumers and makes Pop() fail after the remaining values are taken.
+/// @tparam T The type of the values, which must be trivially copyable.
+template <typename T>
+class DynamicStringQueue
+{
+public:
+    /// @brief Constructor that creates an empty queue.
+    /// @param capacity The maximum number of values in the queue, rounded up to a power of two.
+    explicit DynamicStringQueue(size_t capacity)
+    {
+        size_t cellCount = 2;
+        while (cellCount < capacity)
+            cellCount *= 2;
+
+        cells = new Cell[cellCount];
+        for (size_t i = 0; i < cellCount; i++)
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        mask = cellCount - 1;
+    }
+
+    DynamicStringQueue(const DynamicStringQueue& other) = delete;
+
+    DynamicStringQueue& operator=(const DynamicStringQueue& other) = delete;
+
+    ~DynamicStringQueue()
+    {
+        delete[] cells;
+    }
+
+public:
+    /// @brief Pushes the value unless the queue is full.
+    /// @param value The value to be pushed.
+    /// @return true if the value has been pushed.
+    bool TryPush(const T& value)
+    {
+        return PushToCell(value) && WakeSleepers();
+    }
+
+    /// @brief Pops a value unless the queue is empty.
+    /// @param value The popped value.
+    /// @return true if a value has been popped.
+    bool TryPop(T& value)
+    {
+        return PopFromCell(value) && WakeSleepers();
+    }
+
+    /// @brief Pushes the value, waiting while the queue is full.
+    /// @param value The value to be pushed.
+    void Push(const T& value)
+    {
+        Wait([this, &value] { return PushToCell(value); });
+        WakeSleepers();
+    }
+
+    /// @brief Pops a value, waiting while the queue is empty and not closed.
+    /// @param value The popped value.
+    /// @return true if a value has been popped, or false if the queue is closed and empty.
+    bool Pop(T& value)
+    {
+        bool popped = false;
+        Wait([this, &value, &popped] {
+            if (PopFromCell(value))
+                return popped = true;
+            // all the values pushed before closing are visible once it is seen
+            if (!closed.load(std::memory_order_acquire))
+                return false;
+            popped = PopFromCell(value);
+            return true;
+        });
+        return popped && WakeSleepers();
+    }
+
+    /// @brief Tells the consumers that no more values will be pushed.
+    void Close()
+    {
+        closed.store(true, std::memory_order_release);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        changed.notify_all();
+    }
+
+private:
+    /// @brief Pushes the value into a free cell without waking the sleeping threads.
+    bool PushToCell(const T& value)
+    {
+        size_t position = pushPosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Cell& cell = cells[position & mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            // a cell is free once its sequence has caught up with the position
+            if (sequence == position)
+            {
+                if (pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    cell.value = value;
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (sequence < position)
+                return false;
+            else
+                position = pushPosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Pops a value from a filled cell without waking the sleeping threads.
+    bool PopFromCell(T& value)
+    {
+        size_t position = popPosition.load(std::memory_order_relaxed);
+        while (true)
+        {
+            Cell& cell = cells[position & mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            // a cell is filled once its sequence is one past the position
+            if (sequence == position + 1)
+            {
+                if (popPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    value = cell.value;
+                    cell.sequence.store(position + mask + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (sequence < position + 1)
+                return false;
+            else
+                position = popPosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief Waits until the specified function returns true: it is retried
+    /// SPIN_COUNT times yielding in between, and then whenever the queue changes.
+    template <typename Done>
+    void Wait(Done done)
+    {
+        for (size_t i = 0; i < SPIN_COUNT; i++)
+        {
+            if (done())
+                return;
+            std::this_thread::yield();
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+        // the sleeper is counted before it looks at the cells again, so a change
+        // made meanwhile either is seen here or sees the sleeper and wakes it
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!done())
+            changed.wait(lock);
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /// @brief Wakes the threads sleeping in Wait(), if there are any.
+    /// @return Always true, so it can follow a successful push or pop.
+    bool WakeSleepers()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepers.load(std::memory_order_relaxed) > 0)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            changed.notify_all();
+        }
+        return true;
+    }
+
+private:
+    static constexpr size_t SPIN_COUNT = 64;
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    Cell* cells;
+    size_t mask;
+
+    // the positions are kept on separate cache lines, since producers and consumers update them
+    alignas(64) std::atomic<size_t> pushPosition { 0 };
+    alignas(64) std::atomic<size_t> popPosition { 0 };
+    std::atomic<bool> closed { false };
+
+    std::atomic<size_t> sleepers { 0 };
+    std::mutex mutex;
+    std::condition_variable changed;
+};
+
+template <typename T>
+constexpr size_t DynamicStringQueue<T>::SPIN_COUNT;
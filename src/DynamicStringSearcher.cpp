@@ -0,0 +1,186 @@
+#include "DynamicStringSearcher.h"
+
+#include <cctype>
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <emmintrin.h>
+#define DYNSTR_SEARCH_SSE2
+#endif
+
+constexpr size_t DynamicStringSearcher::LONG_PATTERN_LENGTH;
+constexpr size_t DynamicStringSearcher::ONE_SHOT_SKIP_TABLE_LENGTH;
+
+/// @brief Returns the table folding every byte value to lower case
+/// with std::tolower, the same way DynamicStringComparator does.
+/// @return The table of 256 lower case byte values.
+static const unsigned char* LowerCaseTable()
+{
+    struct Table
+    {
+        unsigned char values[256];
+        Table()
+        {
+            for (int i = 0; i < 256; i++)
+                values[i] = static_cast<unsigned char>(std::tolower(i));
+        }
+    };
+    static const Table table;
+    return table.values;
+}
+
+/// @brief Finds a short non-empty pattern by first filtering the positions whose
+/// first and last characters match and only then comparing the rest of them.
+static const char* FindShort(const char* begin, const char* end, const char* pattern, size_t patternLength)
+{
+    if (static_cast<size_t>(end - begin) < patternLength)
+        return end;
+    if (patternLength == 1)
+    {
+        const void* found = memchr(begin, pattern[0], end - begin);
+        return found ? static_cast<const char*>(found) : end;
+    }
+
+    const char first = pattern[0];
+    const char last = pattern[patternLength - 1];
+    // the last position a match may start at
+    const char* lastStart = end - patternLength;
+    const char* current = begin;
+
+#ifdef DYNSTR_SEARCH_SSE2
+    const __m128i firsts = _mm_set1_epi8(first);
+    const __m128i lasts = _mm_set1_epi8(last);
+    while (current <= lastStart && lastStart - current >= 15)
+    {
+        __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+        __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current + patternLength - 1));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(
+            _mm_cmpeq_epi8(blockFirst, firsts), _mm_cmpeq_epi8(blockLast, lasts))));
+
+        while (mask)
+        {
+            const char* candidate = current + __builtin_ctz(mask);
+            if (memcmp(candidate + 1, pattern + 1, patternLength - 2) == 0)
+                return candidate;
+            mask &= mask - 1;
+        }
+        current += 16;
+    }
+#endif
+
+    while (current <= lastStart)
+    {
+        const void* found = memchr(current, first, lastStart - current + 1);
+        if (!found) break;
+
+        const char* candidate = static_cast<const char*>(found);
+        if (candidate[patternLength - 1] == last &&
+            memcmp(candidate + 1, pattern + 1, patternLength - 2) == 0)
+            return candidate;
+        current = candidate + 1;
+    }
+    return end;
+}
+
+/// @brief Finds a non-empty pattern using Boyer-Moore-Horspool, shifting the window
+/// by the precomputed distance for the character that ends it. When a fold table
+/// is given both the pattern and the characters are compared folded by it.
+static const char* FindHorspool(const char* begin, const char* end, const char* pattern,
+    size_t patternLength, const size_t* shifts, const unsigned char* fold)
+{
+    if (static_cast<size_t>(end - begin) < patternLength)
+        return end;
+
+    const unsigned char* text = reinterpret_cast<const unsigned char*>(begin);
+    const unsigned char* needle = reinterpret_cast<const unsigned char*>(pattern);
+    const size_t lastIndex = patternLength - 1;
+    const size_t lastStart = (end - begin) - patternLength;
+
+    for (size_t position = 0; position <= lastStart; )
+    {
+        unsigned char tail = text[position + lastIndex];
+        if (fold) tail = fold[tail];
+
+        if (tail == needle[lastIndex])
+        {
+            size_t i = lastIndex;
+            if (fold)
+                while (i > 0 && fold[text[position + i - 1]] == needle[i - 1]) i--;
+            else
+                while (i > 0 && text[position + i - 1] == needle[i - 1]) i--;
+
+            if (i == 0)
+                return begin + position;
+        }
+        position += shifts[tail];
+    }
+    return end;
+}
+
+/// @brief Fills the Horspool shifts of the specified pattern.
+static void BuildShifts(const char* pattern, size_t patternLength, size_t* shifts)
+{
+    for (size_t i = 0; i < 256; i++)
+        shifts[i] = patternLength;
+    for (size_t i = 0; i + 1 < patternLength; i++)
+        shifts[static_cast<unsigned char>(pattern[i])] = patternLength - 1 - i;
+}
+
+DynamicStringSearcher::DynamicStringSearcher(DynamicStringView pattern, bool caseInsensitive)
+    : pattern(pattern), caseInsensitive(caseInsensitive)
+{
+    size_t patternLength = pattern.Length();
+    if (caseInsensitive)
+    {
+        const unsigned char* fold = LowerCaseTable();
+        for (size_t i = 0; i < patternLength; i++)
+            this->pattern[i] = static_cast<char>(fold[static_cast<unsigned char>(pattern[i])]);
+    }
+
+    // case insensitive search always folds through the skip table
+    usesSkipTable = caseInsensitive || patternLength >= LONG_PATTERN_LENGTH;
+    if (!usesSkipTable) return;
+
+    BuildShifts(this->pattern.Characters(), patternLength, shifts);
+}
+
+size_t DynamicStringSearcher::Find(DynamicStringView haystack, size_t offset) const
+{
+    if (offset > haystack.Length())
+        return DynamicString::NOT_FOUND;
+    if (pattern.Length() == 0)
+        return offset;
+
+    const char* begin = haystack.Characters() + offset;
+    const char* end = haystack.end();
+    const char* found = usesSkipTable
+        ? FindHorspool(begin, end, pattern.Characters(), pattern.Length(),
+            shifts, caseInsensitive ? LowerCaseTable() : nullptr)
+        : FindShort(begin, end, pattern.Characters(), pattern.Length());
+
+    return found == end ? DynamicString::NOT_FOUND : found - haystack.Characters();
+}
+
+size_t DynamicStringSearcher::Find(DynamicStringView haystack, DynamicStringView pattern, size_t offset)
+{
+    if (offset > haystack.Length())
+        return DynamicString::NOT_FOUND;
+    if (pattern.IsEmpty())
+        return offset;
+
+    const char* begin = haystack.Characters() + offset;
+    const char* end = haystack.end();
+    const char* found;
+
+    // the skip table pays for filling its 256 entries only when there are many
+    // characters to skip over; it is built on the stack without copying the pattern
+    if (pattern.Length() >= LONG_PATTERN_LENGTH && static_cast<size_t>(end - begin) >= ONE_SHOT_SKIP_TABLE_LENGTH)
+    {
+        size_t shifts[256];
+        BuildShifts(pattern.Characters(), pattern.Length(), shifts);
+        found = FindHorspool(begin, end, pattern.Characters(), pattern.Length(), shifts, nullptr);
+    }
+    else
+        found = FindShort(begin, end, pattern.Characters(), pattern.Length());
+
+    return found == end ? DynamicString::NOT_FOUND : found - haystack.Characters();
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "DynamicString.h"
+
+/// @brief Represents a substring search precompiled for a single pattern,
+/// so the same pattern can be searched for in many strings without
+/// preparing it again. The algorithm is picked by the pattern length:
+/// short patterns are found by filtering on their first and last characters
+/// (16 positions at a time when SSE2 is available), while long patterns
+/// use Boyer-Moore-Horspool to skip over the characters that cannot match.
+class DynamicStringSearcher
+{
+public:
+    /// @brief Patterns of at least this length are searched using skip tables,
+    /// which are worth precompiling when the same pattern is searched repeatedly.
+    static constexpr size_t LONG_PATTERN_LENGTH = 32;
+
+public:
+    /// @brief Constructor that precompiles the specified pattern.
+    /// @param pattern The character sequence to be searched for.
+    /// @param caseInsensitive Whether characters are compared case insensitive
+    /// the same way DynamicStringComparator compares them.
+    DynamicStringSearcher(DynamicStringView pattern, bool caseInsensitive = false);
+
+public:
+    /// @brief Finds the first occurrence of the pattern at or after the specified offset.
+    /// An empty pattern is found at the offset if it is within the string.
+    /// @param haystack The characters to search in.
+    /// @param offset The index to start the search at.
+    /// @return The index of the occurrence or DynamicString::NOT_FOUND.
+    size_t Find(DynamicStringView haystack, size_t offset = 0) const;
+
+    /// @brief Returns the precompiled pattern. Case insensitive
+    /// patterns are stored in lower case.
+    /// @return The precompiled pattern.
+    const DynamicString& Pattern() const { return pattern; }
+
+public:
+    /// @brief Finds the first occurrence of the pattern at or after the specified
+    /// offset without precompiling it, which suits searches done only once.
+    /// A long pattern searched in many characters still gets a skip table,
+    /// built anew on every call, so callers searching for the same long
+    /// pattern repeatedly should hold a DynamicStringSearcher instead.
+    /// @param haystack The characters to search in.
+    /// @param pattern The character sequence to be searched for.
+    /// @param offset The index to start the search at.
+    /// @return The index of the occurrence or DynamicString::NOT_FOUND.
+    static size_t Find(DynamicStringView haystack, DynamicStringView pattern, size_t offset = 0);
+
+private:
+    /// @brief The number of characters from which a single search for a long
+    /// pattern builds a skip table rather than filtering the positions.
+    static constexpr size_t ONE_SHOT_SKIP_TABLE_LENGTH = 1024;
+
+    DynamicString pattern;
+    bool caseInsensitive;
+    bool usesSkipTable;
+
+    // Horspool shift for every byte value that ends a window
+    size_t shifts[256];
+};
@@ -0,0 +1,300 @@
+#include "DynamicStringSet.h"
+
+constexpr size_t DynamicStringSet::MAX_KEYS;
+constexpr size_t DynamicStringSet::MIN_KEYS;
+
+DynamicStringSet::DynamicStringSet(Comparator comparator)
+    : comparator(comparator), root(new Node), firstLeaf(root)
+{ }
+
+DynamicStringSet::DynamicStringSet(DynamicStringSet&& other) noexcept
+    : comparator(other.comparator), root(other.root), firstLeaf(other.firstLeaf), size(other.size)
+{
+    // leaving the other set empty but usable
+    other.root = other.firstLeaf = new Node;
+    other.size = 0;
+}
+
+DynamicStringSet::~DynamicStringSet()
+{
+    Destroy(root);
+}
+
+bool DynamicStringSet::Insert(DynamicString string)
+{
+    DynamicString splitKey;
+    Node* splitNode = nullptr;
+    if (!InsertInto(root, string, splitKey, splitNode))
+        return false;
+
+    // the root has been split, so the tree grows by one level
+    if (splitNode)
+    {
+        Node* newRoot = new Node;
+        newRoot->keys.push_back(std::move(splitKey));
+        newRoot->children.push_back(root);
+        newRoot->children.push_back(splitNode);
+        root = newRoot;
+    }
+
+    size++;
+    return true;
+}
+
+bool DynamicStringSet::Remove(const DynamicString& string)
+{
+    if (!RemoveFrom(root, string))
+        return false;
+
+    // the root with a single child is replaced by the child
+    if (!root->IsLeaf() && root->keys.empty())
+    {
+        Node* oldRoot = root;
+        root = root->children.front();
+        oldRoot->children.clear();
+        delete oldRoot;
+    }
+
+    size--;
+    return true;
+}
+
+DynamicStringSet::Iterator DynamicStringSet::Find(const DynamicString& string) const
+{
+    Iterator found = LowerBound(string);
+    if (found != end() && !comparator(string, *found))
+        return found;
+    return end();
+}
+
+DynamicStringSet::Iterator DynamicStringSet::LowerBound(const DynamicString& string) const
+{
+    return PartitionPoint([this, &string](const DynamicString& key) {
+        return comparator(key, string);
+    });
+}
+
+DynamicStringSet::Iterator DynamicStringSet::UpperBound(const DynamicString& string) const
+{
+    return PartitionPoint([this, &string](const DynamicString& key) {
+        return !comparator(string, key);
+    });
+}
+
+DynamicStringSet::Range DynamicStringSet::Between(const DynamicString& first, const DynamicString& last) const
+{
+    Iterator begin = LowerBound(first);
+    // an empty range if the bounds are out of order
+    if (!comparator(first, last))
+        return Range { begin, begin };
+    return Range { begin, LowerBound(last) };
+}
+
+DynamicStringSet::Range DynamicStringSet::WithPrefix(DynamicStringView prefix) const
+{
+    // a string starts with the prefix if its first characters are equivalent to it;
+    // cutting strings to the length of the prefix keeps them in order, so the
+    // strings with the prefix are the ones between the two partition points
+    if (comparator == DynamicStringComparator::Lexicographical)
+    {
+        // the default order compares views of the first characters without copying them
+        Iterator first = PartitionPoint([&prefix](const DynamicString& key) {
+            return DynamicStringView(key).Substring(0, prefix.Length()).Compare(prefix) < 0;
+        });
+        Iterator last = PartitionPoint([&prefix](const DynamicString& key) {
+            return DynamicStringView(key).Substring(0, prefix.Length()).Compare(prefix) <= 0;
+        });
+        return Range { first, last };
+    }
+
+    // other orders compare dynamic strings, so the first characters are copied
+    // into a single string reused for every comparison
+    DynamicString prefixString(prefix);
+    DynamicString headString(prefix.Length());
+    auto head = [&prefix, &headString](const DynamicString& key) -> const DynamicString& {
+        if (key.Length() <= prefix.Length())
+            return key;
+        headString.Truncate(0);
+        headString.Concatenate(key.Characters(), prefix.Length());
+        return headString;
+    };
+
+    Iterator first = PartitionPoint([&](const DynamicString& key) {
+        return comparator(head(key), prefixString);
+    });
+    Iterator last = PartitionPoint([&](const DynamicString& key) {
+        return !comparator(prefixString, head(key));
+    });
+    return Range { first, last };
+}
+
+void DynamicStringSet::Clear()
+{
+    Destroy(root);
+    root = firstLeaf = new Node;
+    size = 0;
+}
+
+DynamicStringSet& DynamicStringSet::operator=(DynamicStringSet&& other) noexcept
+{
+    if (this != &other)
+    {
+        Destroy(root);
+        comparator = other.comparator;
+        root = other.root;
+        firstLeaf = other.firstLeaf;
+        size = other.size;
+
+        other.root = other.firstLeaf = new Node;
+        other.size = 0;
+    }
+    return *this;
+}
+
+bool DynamicStringSet::InsertInto(Node* node, DynamicString& string, DynamicString& splitKey, Node*& splitNode)
+{
+    std::vector<DynamicString>& keys = node->keys;
+    if (node->IsLeaf())
+    {
+        auto position = std::lower_bound(keys.begin(), keys.end(), string, comparator);
+        if (position != keys.end() && !comparator(string, *position))
+            return false;
+        keys.insert(position, std::move(string));
+    }
+    else
+    {
+        // an equivalent string can only be in the child following the separators not after it
+        size_t child = std::upper_bound(keys.begin(), keys.end(), string, comparator) - keys.begin();
+        DynamicString childSplitKey;
+        Node* childSplitNode = nullptr;
+        if (!InsertInto(node->children[child], string, childSplitKey, childSplitNode))
+            return false;
+        if (!childSplitNode)
+            return true;
+
+        keys.insert(keys.begin() + child, std::move(childSplitKey));
+        node->children.insert(node->children.begin() + child + 1, childSplitNode);
+    }
+
+    if (keys.size() <= MAX_KEYS)
+        return true;
+
+    // splitting the overflowed node in halves
+    size_t middle = keys.size() / 2;
+    splitNode = new Node;
+    if (node->IsLeaf())
+    {
+        splitNode->keys.assign(std::make_move_iterator(keys.begin() + middle), std::make_move_iterator(keys.end()));
+        keys.erase(keys.begin() + middle, keys.end());
+        splitKey = splitNode->keys.front();
+
+        splitNode->next = node->next;
+        node->next = splitNode;
+    }
+    else
+    {
+        // the middle separator moves up to the parent
+        splitKey = std::move(keys[middle]);
+        splitNode->keys.assign(std::make_move_iterator(keys.begin() + middle + 1), std::make_move_iterator(keys.end()));
+        splitNode->children.assign(node->children.begin() + middle + 1, node->children.end());
+        keys.erase(keys.begin() + middle, keys.end());
+        node->children.erase(node->children.begin() + middle + 1, node->children.end());
+    }
+    return true;
+}
+
+bool DynamicStringSet::RemoveFrom(Node* node, const DynamicString& string)
+{
+    std::vector<DynamicString>& keys = node->keys;
+    if (node->IsLeaf())
+    {
+        auto position = std::lower_bound(keys.begin(), keys.end(), string, comparator);
+        if (position == keys.end() || comparator(string, *position))
+            return false;
+        keys.erase(position);
+        return true;
+    }
+
+    size_t child = std::upper_bound(keys.begin(), keys.end(), string, comparator) - keys.begin();
+    if (!RemoveFrom(node->children[child], string))
+        return false;
+
+    if (node->children[child]->keys.size() < MIN_KEYS)
+        Rebalance(node, child);
+    return true;
+}
+
+void DynamicStringSet::Rebalance(Node* parent, size_t child)
+{
+    Node* node = parent->children[child];
+    Node* left = child > 0 ? parent->children[child - 1] : nullptr;
+    Node* right = child + 1 < parent->children.size() ? parent->children[child + 1] : nullptr;
+
+    if (left && left->keys.size() > MIN_KEYS)
+    {
+        // borrowing the last string of the left sibling
+        if (node->IsLeaf())
+        {
+            node->keys.insert(node->keys.begin(), std::move(left->keys.back()));
+            left->keys.pop_back();
+            parent->keys[child - 1] = node->keys.front();
+        }
+        else
+        {
+            node->keys.insert(node->keys.begin(), std::move(parent->keys[child - 1]));
+            parent->keys[child - 1] = std::move(left->keys.back());
+            left->keys.pop_back();
+            node->children.insert(node->children.begin(), left->children.back());
+            left->children.pop_back();
+        }
+    }
+    else if (right && right->keys.size() > MIN_KEYS)
+    {
+        // borrowing the first string of the right sibling
+        if (node->IsLeaf())
+        {
+            node->keys.push_back(std::move(right->keys.front()));
+            right->keys.erase(right->keys.begin());
+            parent->keys[child] = right->keys.front();
+        }
+        else
+        {
+            node->keys.push_back(std::move(parent->keys[child]));
+            parent->keys[child] = std::move(right->keys.front());
+            right->keys.erase(right->keys.begin());
+            node->children.push_back(right->children.front());
+            right->children.erase(right->children.begin());
+        }
+    }
+    else if (left)
+        Merge(parent, child - 1);
+    else if (right)
+        Merge(parent, child);
+}
+
+void DynamicStringSet::Merge(Node* parent, size_t child)
+{
+    Node* left = parent->children[child];
+    Node* right = parent->children[child + 1];
+
+    // the separator of inner nodes moves down between their children
+    if (!left->IsLeaf())
+        left->keys.push_back(std::move(parent->keys[child]));
+    left->keys.insert(left->keys.end(),
+        std::make_move_iterator(right->keys.begin()), std::make_move_iterator(right->keys.end()));
+    left->children.insert(left->children.end(), right->children.begin(), right->children.end());
+    left->next = right->next;
+
+    parent->keys.erase(parent->keys.begin() + child);
+    parent->children.erase(parent->children.begin() + child + 1);
+
+    right->children.clear();
+    delete right;
+}
+
+void DynamicStringSet::Destroy(Node* node)
+{
+    for (Node* child : node->children)
+        Destroy(child);
+    delete node;
+}
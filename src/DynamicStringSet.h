@@ -0,0 +1,238 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringComparator.h"
+
+/// @brief Represents an ordered set of dynamic strings that stays sorted while
+/// strings are inserted and removed. The strings are stored in a B+tree: up to
+/// 32 strings are kept contiguously in each node and the leaves are linked,
+/// so lookups, insertions and removals take O(log n) steps and ordered
+/// iteration walks the leaves sequentially.
+///
+/// The order is defined by a comparator such as the ones of DynamicStringComparator.
+/// Strings the comparator considers equivalent are stored only once.
+class DynamicStringSet
+{
+public:
+    using Comparator = bool (*)(const DynamicString&, const DynamicString&);
+
+private:
+    struct Node
+    {
+        // separators in inner nodes: every string of children[i] goes before
+        // keys[i], and keys[i] does not go after any string of children[i + 1]
+        std::vector<DynamicString> keys;
+        std::vector<Node*> children;
+
+        // links between the leaves in the order of the set
+        Node* next = nullptr;
+
+        bool IsLeaf() const { return children.empty(); }
+    };
+
+public:
+    /// @brief Represents a read-only forward iterator over the strings of the set.
+    /// Inserting or removing strings invalidates all the iterators.
+    class Iterator
+    {
+    public:
+        using value_type = DynamicString;
+        using pointer = const DynamicString*;
+        using reference = const DynamicString&;
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+
+    public:
+        Iterator() = default;
+
+        Iterator& operator++()
+        {
+            index++;
+            Normalize();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator iterator = *this;
+            ++(*this);
+            return iterator;
+        }
+
+        const DynamicString& operator*() const { return leaf->keys[index]; }
+
+        const DynamicString* operator->() const { return &leaf->keys[index]; }
+
+        bool operator==(const Iterator& other) const
+        {
+            return leaf == other.leaf && index == other.index;
+        }
+
+        bool operator!=(const Iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        friend class DynamicStringSet;
+
+        Iterator(const Node* leaf, size_t index)
+            : leaf(leaf), index(index)
+        {
+            Normalize();
+        }
+
+        /// @brief Moves past the end of a leaf to the start of the next one.
+        void Normalize()
+        {
+            while (leaf && index >= leaf->keys.size())
+            {
+                leaf = leaf->next;
+                index = 0;
+            }
+        }
+
+    private:
+        const Node* leaf = nullptr;
+        size_t index = 0;
+    };
+
+    /// @brief Represents a range of strings of the set that can be iterated over.
+    struct Range
+    {
+        Iterator first;
+        Iterator last;
+
+        Iterator begin() const { return first; }
+        Iterator end() const { return last; }
+    };
+
+public:
+    /// @brief Constructor that creates an empty set.
+    /// @param comparator The function telling whether a string goes before another one.
+    DynamicStringSet(Comparator comparator = DynamicStringComparator::Lexicographical);
+
+    DynamicStringSet(const DynamicStringSet& other) = delete;
+
+    /// @brief A move constructor that takes over the strings of another set.
+    /// @param other The set to be moved.
+    DynamicStringSet(DynamicStringSet&& other) noexcept;
+
+    /// @brief Destroy the set and all of its strings.
+    ~DynamicStringSet();
+
+public:
+    /// @brief Inserts the specified string unless an equivalent string is already in the set.
+    /// @param string The string to be inserted.
+    /// @return true if the string has been inserted.
+    bool Insert(DynamicString string);
+
+    /// @brief Removes the string equivalent to the specified one.
+    /// @param string The string to be removed.
+    /// @return true if a string has been removed.
+    bool Remove(const DynamicString& string);
+
+    /// @brief Returns a value indicating whether an equivalent string is in the set.
+    /// @param string The string to look for.
+    /// @return true if an equivalent string is in the set.
+    bool Contains(const DynamicString& string) const { return Find(string) != end(); }
+
+    /// @brief Finds the string equivalent to the specified one.
+    /// @param string The string to look for.
+    /// @return An iterator to the string found or end() if there is none.
+    Iterator Find(const DynamicString& string) const;
+
+    /// @brief Returns an iterator to the first string that does not go before the specified one.
+    /// @param string The string to compare with.
+    /// @return An iterator to the first string that does not go before the specified one.
+    Iterator LowerBound(const DynamicString& string) const;
+
+    /// @brief Returns an iterator to the first string that goes after the specified one.
+    /// @param string The string to compare with.
+    /// @return An iterator to the first string that goes after the specified one.
+    Iterator UpperBound(const DynamicString& string) const;
+
+    /// @brief Returns the strings that do not go before the first string
+    /// and go before the last one.
+    /// @param first The inclusive lower bound of the range.
+    /// @param last The exclusive upper bound of the range.
+    /// @return The strings within the range.
+    Range Between(const DynamicString& first, const DynamicString& last) const;
+
+    /// @brief Returns the strings starting with the specified prefix, where
+    /// characters are matched the way the comparator compares them.
+    /// Requires a comparator that orders strings by their characters from the
+    /// first to the last one, like all the comparators of DynamicStringComparator.
+    /// @param prefix The prefix of the strings.
+    /// @return The strings starting with the prefix.
+    Range WithPrefix(DynamicStringView prefix) const;
+
+    /// @brief Removes all the strings from the set.
+    void Clear();
+
+    /// @brief Returns the number of strings in the set.
+    /// @return The number of strings in the set.
+    size_t Size() const { return size; }
+
+    /// @brief Returns an iterator to the first string of the set.
+    /// @return An iterator to the first string of the set.
+    Iterator begin() const { return Iterator(firstLeaf, 0); }
+
+    /// @brief Returns an iterator one past the last string of the set.
+    /// @return An iterator one past the last string of the set.
+    Iterator end() const { return Iterator(); }
+
+public:
+    DynamicStringSet& operator=(const DynamicStringSet& other) = delete;
+
+    /// @brief Move assignment operator that releases the strings of this set
+    /// and takes over the strings of another one.
+    /// @param other A set rvalue object to be moved.
+    /// @return A reference to this set.
+    DynamicStringSet& operator=(DynamicStringSet&& other) noexcept;
+
+private:
+    /// @brief Returns an iterator to the first string for which the predicate is false,
+    /// given that the predicate is true for a prefix of the set and false for the rest.
+    template <typename Predicate>
+    Iterator PartitionPoint(Predicate isBefore) const
+    {
+        const Node* node = root;
+        while (!node->IsLeaf())
+        {
+            size_t child = std::partition_point(node->keys.begin(), node->keys.end(), isBefore) - node->keys.begin();
+            node = node->children[child];
+        }
+        return Iterator(node, std::partition_point(node->keys.begin(), node->keys.end(), isBefore) - node->keys.begin());
+    }
+
+    /// @brief Inserts the string into the subtree, splitting the node if it overflows.
+    /// @return true if the string has been inserted.
+    bool InsertInto(Node* node, DynamicString& string, DynamicString& splitKey, Node*& splitNode);
+
+    /// @brief Removes the string from the subtree, rebalancing the nodes that underflow.
+    /// @return true if the string has been removed.
+    bool RemoveFrom(Node* node, const DynamicString& string);
+
+    /// @brief Refills the underflowed child of the parent from a sibling or merges them.
+    void Rebalance(Node* parent, size_t child);
+
+    /// @brief Merges the child following the specified one into it.
+    void Merge(Node* parent, size_t child);
+
+    /// @brief Destroys the subtree.
+    static void Destroy(Node* node);
+
+private:
+    static constexpr size_t MAX_KEYS = 32;
+    static constexpr size_t MIN_KEYS = MAX_KEYS / 2;
+
+    Comparator comparator;
+    Node* root;
+    Node* firstLeaf;
+    size_t size = 0;
+};
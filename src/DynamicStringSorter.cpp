@@ -0,0 +1,137 @@
+#include "DynamicStringSorter.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+constexpr size_t DynamicStringSorter::THREADS_PER_CORE;
+
+DynamicStringSorter::DynamicStringSorter(Comparator comparator, Options options)
+    : comparator(comparator), options(options)
+{
+    if (this->options.count)
+        this->options.unique = true;
+}
+
+void DynamicStringSorter::Add(DynamicString&& string)
+{
+    Line line = MakeLine(std::move(string));
+
+    if (options.unique)
+    {
+        // only equal strings are merged, so folding never changes which strings are kept
+        auto found = lineIndices.find(line.string);
+        if (found != lineIndices.end())
+        {
+            lines[found->second].count++;
+            return;
+        }
+
+        lines.push_back(std::move(line));
+        lineIndices.emplace(lines.back().string, lines.size() - 1);
+        return;
+    }
+
+    if (options.top == 0)
+    {
+        lines.push_back(std::move(line));
+        return;
+    }
+
+    // the heap keeps the top strings with the last of them at the front
+    auto precedes = [this](const Line& first, const Line& second) { return Precedes(first, second); };
+    if (lines.size() < options.top)
+    {
+        lines.push_back(std::move(line));
+        std::push_heap(lines.begin(), lines.end(), precedes);
+    }
+    else if (Precedes(line, lines.front()))
+    {
+        std::pop_heap(lines.begin(), lines.end(), precedes);
+        lines.back() = std::move(line);
+        std::push_heap(lines.begin(), lines.end(), precedes);
+    }
+}
+
+DynamicStringSorter::Line DynamicStringSorter::MakeLine(DynamicString&& string) const
+{
+    // without folding the key has no characters, so it allocates no memory
+    Line line { std::move(string), DynamicString(static_cast<const char*>(nullptr)), 1 };
+    if (options.fold)
+    {
+        line.key = line.string;
+        line.key.ToLower();
+    }
+    return line;
+}
+
+void DynamicStringSorter::WriteTo(DynamicStringWriter& writer)
+{
+    auto precedes = [this](const Line& first, const Line& second) { return Precedes(first, second); };
+    size_t count = lines.size();
+    if (options.top > 0 && options.top < count)
+    {
+        std::partial_sort(lines.begin(), lines.begin() + options.top, lines.end(), precedes);
+        count = options.top;
+    }
+    else
+        std::sort(lines.begin(), lines.end(), precedes);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        if (options.count)
+        {
+            char prefix[32];
+            int length = snprintf(prefix, sizeof(prefix), "%7llu ",
+                static_cast<unsigned long long>(lines[i].count));
+            writer.Write(DynamicStringView(prefix, length));
+        }
+        writer.WriteLine(lines[i].string);
+    }
+}
+
+bool DynamicStringSorter::ParseOptions(int argc, const char* const* argv, Options& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        DynamicStringView argument = argv[i];
+        if (argument == "--unique")
+            options.unique = true;
+        else if (argument == "--count")
+            options.count = true;
+        else if (argument == "--fold")
+            options.fold = true;
+        else if ((argument == "--top" || argument == "--threads") && i + 1 < argc)
+        {
+            // strtoull() would accept a sign or spaces and wrap negative numbers around
+            const char* number = argv[++i];
+            if (*number < '0' || *number > '9')
+                return false;
+
+            char* end = nullptr;
+            errno = 0;
+            unsigned long long value = strtoull(number, &end, 10);
+            if (*end != '\0' || errno == ERANGE || value == 0 || value > static_cast<size_t>(-1))
+                return false;
+
+            if (argument == "--top")
+                options.top = static_cast<size_t>(value);
+            else if (value <= MaxThreads())
+                options.threads = static_cast<size_t>(value);
+            else
+                return false;
+        }
+        else
+            return false;
+    }
+    return true;
+}
+
+size_t DynamicStringSorter::MaxThreads()
+{
+    // the number of hardware threads is unknown on some systems
+    size_t hardwareThreads = std::thread::hardware_concurrency();
+    return THREADS_PER_CORE * (hardwareThreads > 0 ? hardwareThreads : 1);
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringWriter.h"
+
+/// @brief Represents the sorting stage of the dynstr program. Strings are
+/// added one by one and written out in the order of the comparator.
+/// Depending on the options, only the first strings of that order are kept
+/// in a bounded heap, and equal strings are merged by hashing them before
+/// sorting, so duplicates are never sorted.
+class DynamicStringSorter
+{
+public:
+    using Comparator = bool (*)(const DynamicString&, const DynamicString&);
+
+    /// @brief Represents the options of the sorting stage.
+    struct Options
+    {
+        /// @brief The number of first strings to be written; zero writes all of them.
+        size_t top = 0;
+
+        /// @brief Whether equal strings are written only once.
+        bool unique = false;
+
+        /// @brief Whether each distinct string is prefixed by the number of
+        /// its occurrences, like `uniq -c` does. Implies unique.
+        bool count = false;
+
+        /// @brief Whether the strings are compared by their copies converted to lower
+        /// case once when they are added, so they can be compared as plain bytes
+        /// instead of folding the case on every comparison. The output is the same
+        /// as without folding, except that strings equal but for case, whose order
+        /// is unspecified otherwise, are ordered by their bytes like `sort -f` does.
+        /// Unique strings are still the strings of equal bytes.
+        bool fold = false;
+
+        /// @brief The number of threads sorting chunks of the input while it is
+        /// being read; zero reads, sorts and writes one stage after another.
+        size_t threads = 0;
+    };
+
+public:
+    /// @brief Constructor that creates an empty sorter.
+    /// @param comparator The function telling whether a string goes before another one.
+    /// @param options The options of the sorting stage.
+    DynamicStringSorter(Comparator comparator, Options options);
+
+public:
+    /// @brief Adds the specified string to be sorted. With the top option,
+    /// at most that many strings are kept at any time.
+    /// @param string The string to be added.
+    void Add(DynamicString&& string);
+
+    /// @brief Sorts the kept strings and writes them one per line.
+    /// @param writer The writer to write the strings to.
+    void WriteTo(DynamicStringWriter& writer);
+
+    /// @brief Returns the number of strings kept for sorting.
+    /// @return The number of strings kept for sorting.
+    size_t Size() const { return lines.size(); }
+
+    /// @brief Parses the command-line options of the sorting stage:
+    /// `--top K`, `--unique`, `--count`, `--fold` and `--threads N`.
+    /// The numbers must be positive decimal numbers, and N must not exceed MaxThreads().
+    /// @param argc The number of arguments.
+    /// @param argv The arguments, the first of them being the program name.
+    /// @param options The options to be filled.
+    /// @return true if all the arguments are valid options.
+    static bool ParseOptions(int argc, const char* const* argv, Options& options);
+
+    /// @brief Returns the largest number of sorting threads accepted by ParseOptions(),
+    /// which is a few times the number of hardware threads.
+    /// @return The largest number of sorting threads.
+    static size_t MaxThreads();
+
+private:
+    struct Line
+    {
+        DynamicString string;
+
+        // the characters in lower case with the fold option, none otherwise
+        DynamicString key;
+        size_t count;
+    };
+
+    /// @brief Makes the line of the specified string, converting its key when folding.
+    Line MakeLine(DynamicString&& string) const;
+
+    /// @brief Returns a value indicating whether the first line goes before the second one.
+    /// Folded lines with equal keys are ordered by their characters, so the order
+    /// does not depend on the order the lines have been added in.
+    bool Precedes(const Line& first, const Line& second) const
+    {
+        if (!options.fold)
+            return comparator(first.string, second.string);
+
+        if (comparator(first.key, second.key))
+            return true;
+        if (comparator(second.key, first.key))
+            return false;
+        return first.string < second.string;
+    }
+
+private:
+    static constexpr size_t THREADS_PER_CORE = 4;
+
+    Comparator comparator;
+    Options options;
+    std::vector<Line> lines;
+
+    // the keys view the characters of the lines, which stay
+    // in place when the lines themselves are moved
+    std::unordered_map<DynamicStringView, size_t> lineIndices;
+};
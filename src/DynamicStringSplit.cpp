@@ -0,0 +1,144 @@
+#include "DynamicStringSplit.h"
+#include "DynamicStringSearcher.h"
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <emmintrin.h>
+#define DYNSTR_SPLIT_SSE2
+#endif
+
+constexpr size_t DynamicStringSplitRange::MAX_VECTOR_DELIMITERS;
+constexpr size_t DynamicStringSplitRange::SHORT_SEQUENCE_CAPACITY;
+
+void DynamicStringSplitRange::Iterator::Advance()
+{
+    const char* sourceEnd = range->source.end();
+    while (next)
+    {
+        size_t delimiterLength = 0;
+        const char* fieldEnd = range->FindDelimiter(next, delimiterLength);
+
+        field = DynamicStringView(next, fieldEnd - next);
+        // the last field ends at the end of the source
+        next = fieldEnd == sourceEnd ? nullptr : fieldEnd + delimiterLength;
+
+        if (!range->skipEmpty || !field.IsEmpty())
+            return;
+    }
+    finished = true;
+}
+
+DynamicStringSplitRange DynamicStringSplitRange::Split(DynamicStringView source, char delimiter)
+{
+    DynamicStringSplitRange range(source, Mode::Character, false);
+    range.delimiter = delimiter;
+    return range;
+}
+
+DynamicStringSplitRange DynamicStringSplitRange::Split(DynamicStringView source, DynamicStringView delimiter)
+{
+    if (delimiter.Length() == 1)
+        return Split(source, delimiter[0]);
+
+    static_assert(SHORT_SEQUENCE_CAPACITY >= DynamicStringSearcher::LONG_PATTERN_LENGTH - 1,
+        "the sequences not compiled into searchers must fit in the range");
+
+    DynamicStringSplitRange range(source, Mode::Sequence, false);
+    range.sequenceLength = delimiter.Length();
+    // the skip table of a long delimiter is built once rather than for every field
+    if (delimiter.Length() >= DynamicStringSearcher::LONG_PATTERN_LENGTH)
+        range.searcher = std::make_shared<const DynamicStringSearcher>(delimiter);
+    else
+        memcpy(range.shortSequence, delimiter.Characters(), delimiter.Length());
+    return range;
+}
+
+DynamicStringSplitRange DynamicStringSplitRange::SplitAny(DynamicStringView source, DynamicStringView delimiters)
+{
+    DynamicStringSplitRange range(source, Mode::AnyOf, false);
+    size_t distinctCount = 0;
+    for (char character : delimiters)
+    {
+        unsigned char byte = static_cast<unsigned char>(character);
+        if (range.delimiterSet[byte >> 6] & (uint64_t(1) << (byte & 63)))
+            continue;
+
+        range.delimiterSet[byte >> 6] |= uint64_t(1) << (byte & 63);
+        if (distinctCount < MAX_VECTOR_DELIMITERS)
+            range.vectorDelimiters[distinctCount] = character;
+        distinctCount++;
+    }
+    range.vectorDelimiterCount = distinctCount <= MAX_VECTOR_DELIMITERS ? distinctCount : 0;
+    return range;
+}
+
+DynamicStringSplitRange DynamicStringSplitRange::Tokenize(DynamicStringView source, DynamicStringView delimiters)
+{
+    DynamicStringSplitRange range = SplitAny(source, delimiters);
+    range.skipEmpty = true;
+    return range;
+}
+
+const char* DynamicStringSplitRange::FindDelimiter(const char* from, size_t& delimiterLength) const
+{
+    const char* sourceEnd = source.end();
+    size_t remaining = sourceEnd - from;
+
+    switch (mode)
+    {
+    case Mode::Character:
+    {
+        // memchr is vectorized by the C library, so a single
+        // delimiter is scanned many bytes at a time
+        const void* found = memchr(from, delimiter, remaining);
+        delimiterLength = 1;
+        return found ? static_cast<const char*>(found) : sourceEnd;
+    }
+    case Mode::Sequence:
+    {
+        delimiterLength = sequenceLength;
+        if (sequenceLength == 0)
+            return sourceEnd;
+
+        size_t index = searcher
+            ? searcher->Find(DynamicStringView(from, remaining))
+            : DynamicStringSearcher::Find(DynamicStringView(from, remaining), DynamicStringView(shortSequence, sequenceLength));
+        return index == DynamicString::NOT_FOUND ? sourceEnd : from + index;
+    }
+    case Mode::AnyOf:
+    {
+        delimiterLength = 1;
+        const char* current = from;
+
+#ifdef DYNSTR_SPLIT_SSE2
+        // every block of 16 characters is compared with each delimiter in turn
+        if (vectorDelimiterCount > 0)
+        {
+            __m128i sets[MAX_VECTOR_DELIMITERS];
+            for (size_t i = 0; i < vectorDelimiterCount; i++)
+                sets[i] = _mm_set1_epi8(vectorDelimiters[i]);
+
+            for (; sourceEnd - current >= 16; current += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+                __m128i matches = _mm_cmpeq_epi8(block, sets[0]);
+                for (size_t i = 1; i < vectorDelimiterCount; i++)
+                    matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, sets[i]));
+
+                unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(matches));
+                if (mask)
+                    return current + __builtin_ctz(mask);
+            }
+        }
+#endif
+
+        for (; current != sourceEnd; current++)
+        {
+            unsigned char byte = static_cast<unsigned char>(*current);
+            if (delimiterSet[byte >> 6] & (uint64_t(1) << (byte & 63)))
+                return current;
+        }
+        return sourceEnd;
+    }
+    }
+    return sourceEnd;
+}
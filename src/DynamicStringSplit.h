@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+
+#include "DynamicStringView.h"
+
+class DynamicStringSearcher;
+
+/// @brief Represents a lazy range of fields of a character sequence separated
+/// by a delimiter. Fields are produced as views on demand while iterating,
+/// so splitting never copies the characters being split, which must outlive
+/// the range. The delimiters are copied into the range, so they may be
+/// temporaries. Only delimiter sequences long enough to be searched using
+/// skip tables are compiled, once per range.
+class DynamicStringSplitRange
+{
+public:
+    /// @brief Represents a forward iterator over the fields of a split range.
+    class Iterator
+    {
+    public:
+        using value_type = DynamicStringView;
+        using pointer = const DynamicStringView*;
+        using reference = const DynamicStringView&;
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+
+    public:
+        Iterator() = default;
+
+        Iterator& operator++()
+        {
+            Advance();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator iterator = *this;
+            ++(*this);
+            return iterator;
+        }
+
+        const DynamicStringView& operator*() const { return field; }
+
+        const DynamicStringView* operator->() const { return &field; }
+
+        bool operator==(const Iterator& other) const
+        {
+            if (finished || other.finished)
+                return finished == other.finished;
+            return field.Characters() == other.field.Characters();
+        }
+
+        bool operator!=(const Iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        friend class DynamicStringSplitRange;
+
+        Iterator(const DynamicStringSplitRange* range, const char* next)
+            : range(range), next(next), finished(false)
+        {
+            Advance();
+        }
+
+        /// @brief Moves the iterator to the next field, skipping
+        /// empty fields if the range was asked to.
+        void Advance();
+
+    private:
+        const DynamicStringSplitRange* range = nullptr;
+        const char* next = nullptr;
+        DynamicStringView field;
+        bool finished = true;
+    };
+
+public:
+    /// @brief Creates a range of fields of the source separated by the specified character.
+    /// @param source The characters to be split.
+    /// @param delimiter The character separating the fields.
+    /// @return A lazy range of fields.
+    static DynamicStringSplitRange Split(DynamicStringView source, char delimiter);
+
+    /// @brief Creates a range of fields of the source separated by the specified
+    /// sequence of characters. An empty delimiter produces the whole source as one field.
+    /// @param source The characters to be split.
+    /// @param delimiter The character sequence separating the fields; it is copied.
+    /// @return A lazy range of fields.
+    static DynamicStringSplitRange Split(DynamicStringView source, DynamicStringView delimiter);
+
+    /// @brief Creates a range of fields of the source separated by
+    /// any of the characters of the specified set.
+    /// @param source The characters to be split.
+    /// @param delimiters The set of characters separating the fields; it is copied.
+    /// @return A lazy range of fields.
+    static DynamicStringSplitRange SplitAny(DynamicStringView source, DynamicStringView delimiters);
+
+    /// @brief Creates a range of non-empty tokens of the source separated by
+    /// any number of the characters of the specified set.
+    /// @param source The characters to be tokenized.
+    /// @param delimiters The set of characters separating the tokens; it is copied.
+    /// @return A lazy range of non-empty tokens.
+    static DynamicStringSplitRange Tokenize(DynamicStringView source, DynamicStringView delimiters);
+
+public:
+    /// @brief Returns an iterator that points to the first field of the range.
+    /// @return An iterator that points to the first field of the range.
+    Iterator begin() const { return Iterator(this, source.Characters()); }
+
+    /// @brief Returns an iterator that points one past the last field of the range.
+    /// @return An iterator that points one past the last field of the range.
+    Iterator end() const { return Iterator(); }
+
+private:
+    enum class Mode { Character, Sequence, AnyOf };
+
+    DynamicStringSplitRange(DynamicStringView source, Mode mode, bool skipEmpty)
+        : source(source), mode(mode), skipEmpty(skipEmpty)
+    { }
+
+    /// @brief The largest number of distinct delimiters of a set
+    /// that are compared with 16 characters at a time.
+    static constexpr size_t MAX_VECTOR_DELIMITERS = 16;
+
+    /// @brief The number of characters of a delimiter sequence kept in the range
+    /// itself; longer sequences are kept by their searcher.
+    static constexpr size_t SHORT_SEQUENCE_CAPACITY = 32;
+
+    /// @brief Finds the next delimiter at or after the specified position.
+    /// @param from The position to start the search at.
+    /// @param delimiterLength Receives the length of the delimiter found.
+    /// @return The position of the delimiter or the end of the source if none found.
+    const char* FindDelimiter(const char* from, size_t& delimiterLength) const;
+
+private:
+    DynamicStringView source;
+    Mode mode;
+    bool skipEmpty;
+    char delimiter = '\0';
+
+    // a short delimiter sequence is copied here, as the range must not view a
+    // temporary; the searcher of a long one keeps its own copy
+    char shortSequence[SHORT_SEQUENCE_CAPACITY];
+    size_t sequenceLength = 0;
+
+    // shared by the copies of the range, which its iterators point to
+    std::shared_ptr<const DynamicStringSearcher> searcher;
+
+    // a bit for each of 256 byte values, set when the byte is a delimiter
+    uint64_t delimiterSet[4] = { 0, 0, 0, 0 };
+
+    // the distinct delimiters of a set, if there are at most MAX_VECTOR_DELIMITERS of them
+    char vectorDelimiters[MAX_VECTOR_DELIMITERS];
+    size_t vectorDelimiterCount = 0;
+};
@@ -0,0 +1,179 @@
+#include "DynamicStringTransform.h"
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#include <emmintrin.h>
+#define DYNSTR_TRANSFORM_SSE2
+#endif
+
+#if defined(__AVX2__) && defined(__GNUC__)
+#include <immintrin.h>
+#define DYNSTR_TRANSFORM_AVX2
+#endif
+
+static bool IsWhitespace(char character)
+{
+    return character == ' ' || (character >= '\t' && character <= '\r');
+}
+
+/// @brief Flips the case bit of the characters from first to last, which are
+/// either the upper case or the lower case ASCII letters.
+static void ConvertCase(const char* source, size_t length, char* destination, char first, char last)
+{
+    size_t i = 0;
+
+#ifdef DYNSTR_TRANSFORM_AVX2
+    {
+        // the comparisons are signed, so the characters past ASCII are never in range
+        const __m256i belowFirst = _mm256_set1_epi8(static_cast<char>(first - 1));
+        const __m256i aboveLast = _mm256_set1_epi8(static_cast<char>(last + 1));
+        const __m256i caseBit = _mm256_set1_epi8(0x20);
+        for (; i + 32 <= length; i += 32)
+        {
+            __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+            __m256i inRange = _mm256_and_si256(
+                _mm256_cmpgt_epi8(block, belowFirst), _mm256_cmpgt_epi8(aboveLast, block));
+            block = _mm256_xor_si256(block, _mm256_and_si256(inRange, caseBit));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), block);
+        }
+    }
+#endif
+
+#ifdef DYNSTR_TRANSFORM_SSE2
+    {
+        const __m128i belowFirst = _mm_set1_epi8(static_cast<char>(first - 1));
+        const __m128i aboveLast = _mm_set1_epi8(static_cast<char>(last + 1));
+        const __m128i caseBit = _mm_set1_epi8(0x20);
+        for (; i + 16 <= length; i += 16)
+        {
+            __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+            __m128i inRange = _mm_and_si128(
+                _mm_cmpgt_epi8(block, belowFirst), _mm_cmpgt_epi8(aboveLast, block));
+            block = _mm_xor_si128(block, _mm_and_si128(inRange, caseBit));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), block);
+        }
+    }
+#endif
+
+    for (; i < length; i++)
+    {
+        char character = source[i];
+        destination[i] = character >= first && character <= last
+            ? static_cast<char>(character ^ 0x20) : character;
+    }
+}
+
+#ifdef DYNSTR_TRANSFORM_SSE2
+/// @brief Returns the mask of the whitespace characters of a block.
+static unsigned WhitespaceMask(__m128i block)
+{
+    __m128i spaces = _mm_cmpeq_epi8(block, _mm_set1_epi8(' '));
+    __m128i controls = _mm_and_si128(
+        _mm_cmpgt_epi8(block, _mm_set1_epi8('\t' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('\r' + 1), block));
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(spaces, controls)));
+}
+#endif
+
+#ifdef DYNSTR_TRANSFORM_AVX2
+static unsigned WhitespaceMask(__m256i block)
+{
+    __m256i spaces = _mm256_cmpeq_epi8(block, _mm256_set1_epi8(' '));
+    __m256i controls = _mm256_and_si256(
+        _mm256_cmpgt_epi8(block, _mm256_set1_epi8('\t' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('\r' + 1), block));
+    return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_or_si256(spaces, controls)));
+}
+#endif
+
+void DynamicStringTransform::ToLower(const char* source, size_t length, char* destination)
+{
+    ConvertCase(source, length, destination, 'A', 'Z');
+}
+
+void DynamicStringTransform::ToUpper(const char* source, size_t length, char* destination)
+{
+    ConvertCase(source, length, destination, 'a', 'z');
+}
+
+bool DynamicStringTransform::IsAscii(const char* characters, size_t length)
+{
+    size_t i = 0;
+
+#ifdef DYNSTR_TRANSFORM_AVX2
+    for (; i + 32 <= length; i += 32)
+    {
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(characters + i));
+        if (_mm256_movemask_epi8(block) != 0)
+            return false;
+    }
+#endif
+
+#ifdef DYNSTR_TRANSFORM_SSE2
+    // the high bits of the characters are gathered, so any set one is not ASCII
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(characters + i));
+        if (_mm_movemask_epi8(block) != 0)
+            return false;
+    }
+#endif
+
+    for (; i < length; i++)
+        if (static_cast<unsigned char>(characters[i]) >= 0x80)
+            return false;
+    return true;
+}
+
+size_t DynamicStringTransform::CountLeadingWhitespace(const char* characters, size_t length)
+{
+    size_t i = 0;
+
+#ifdef DYNSTR_TRANSFORM_AVX2
+    for (; i + 32 <= length; i += 32)
+    {
+        unsigned mask = WhitespaceMask(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(characters + i)));
+        if (mask != 0xFFFFFFFFu)
+            return i + __builtin_ctz(~mask);
+    }
+#endif
+
+#ifdef DYNSTR_TRANSFORM_SSE2
+    for (; i + 16 <= length; i += 16)
+    {
+        unsigned mask = WhitespaceMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(characters + i)));
+        if (mask != 0xFFFFu)
+            return i + __builtin_ctz(~mask);
+    }
+#endif
+
+    while (i < length && IsWhitespace(characters[i]))
+        i++;
+    return i;
+}
+
+size_t DynamicStringTransform::CountTrailingWhitespace(const char* characters, size_t length)
+{
+    // the blocks are read backwards from the end of the characters
+    size_t remaining = length;
+
+#ifdef DYNSTR_TRANSFORM_AVX2
+    for (; remaining >= 32; remaining -= 32)
+    {
+        unsigned mask = WhitespaceMask(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(characters + remaining - 32)));
+        if (mask != 0xFFFFFFFFu)
+            return length - remaining + __builtin_clz(~mask);
+    }
+#endif
+
+#ifdef DYNSTR_TRANSFORM_SSE2
+    for (; remaining >= 16; remaining -= 16)
+    {
+        unsigned mask = WhitespaceMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(characters + remaining - 16)));
+        if (mask != 0xFFFFu)
+            // the last non-whitespace character is the highest clear bit of the 16
+            return length - remaining + __builtin_clz(~mask & 0xFFFFu) - 16;
+    }
+#endif
+
+    while (remaining > 0 && IsWhitespace(characters[remaining - 1]))
+        remaining--;
+    return length - remaining;
+}
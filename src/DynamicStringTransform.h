@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+
+/// @brief Represents a static class that provides the bulk transforms of
+/// characters used by dynamic strings and views: case conversion, trimming
+/// and classification. The characters are processed 16 at a time when SSE2 is
+/// available and 32 at a time when the code is compiled for AVX2, falling
+/// back to one character at a time otherwise.
+///
+/// Only ASCII characters are converted and classified, just like std::tolower,
+/// std::toupper and std::isspace do in the default "C" locale, so characters
+/// of multibyte encodings are never changed.
+class DynamicStringTransform
+{
+public:
+    /// @brief Writes the specified characters converted to lower case.
+    /// @param source The characters to be converted.
+    /// @param length The number of characters to be converted.
+    /// @param destination The characters to write to; may be the source itself.
+    static void ToLower(const char* source, size_t length, char* destination);
+
+    /// @brief Writes the specified characters converted to upper case.
+    /// @param source The characters to be converted.
+    /// @param length The number of characters to be converted.
+    /// @param destination The characters to write to; may be the source itself.
+    static void ToUpper(const char* source, size_t length, char* destination);
+
+    /// @brief Returns a value indicating whether all the specified characters are ASCII.
+    /// @param characters The characters to be checked.
+    /// @param length The number of characters to be checked.
+    /// @return true if no character has its high bit set.
+    static bool IsAscii(const char* characters, size_t length);
+
+    /// @brief Returns the number of whitespace characters at the start of the
+    /// specified characters, whitespace being what std::isspace tells in the "C" locale.
+    /// @param characters The characters to be checked.
+    /// @param length The number of characters to be checked.
+    /// @return The number of leading whitespace characters.
+    static size_t CountLeadingWhitespace(const char* characters, size_t length);
+
+    /// @brief Returns the number of whitespace characters at the end of the
+    /// specified characters, whitespace being what std::isspace tells in the "C" locale.
+    /// @param characters The characters to be checked.
+    /// @param length The number of characters to be checked.
+    /// @return The number of trailing whitespace characters.
+    static size_t CountTrailingWhitespace(const char* characters, size_t length);
+};
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <assert.h>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+#include "DynamicStringTransform.h"
+
+/// @brief A non-owning read-only view of a sequence of characters.
+/// The viewed characters are not required to be null-terminated,
+/// so a view must be read using its length.
+class DynamicStringView
+{
+public:
+    using Iterator = const char*;
+
+public:
+    /// @brief Default constructor that creates a view of an empty string.
+    DynamicStringView() = default;
+
+    /// @brief Constructor that creates a view of the specified
+    /// null-terminated character sequence.
+    /// @param value The null-terminated character sequence to be viewed.
+    DynamicStringView(const char* value)
+        : characters(value ? value : ""), length(value ? strlen(value) : 0)
+    { }
+
+    /// @brief Constructor that creates a view of the specified number
+    /// of characters starting at the specified pointer.
+    /// @param value The first character to be viewed.
+    /// @param length The number of characters to be viewed.
+    constexpr DynamicStringView(const char* value, size_t length)
+        : characters(value ? value : ""), length(value ? length : 0)
+    { }
+
+public:
+    /// @brief Returns the number of characters within the view.
+    /// @return The number of characters within the view.
+    constexpr size_t Length() const { return length; }
+
+    /// @brief Returns a value indicating whether the view has no characters.
+    /// @return true if the length of the view is zero.
+    constexpr bool IsEmpty() const { return length == 0; }
+
+    /// @brief Returns const pointer to the viewed characters.
+    /// The characters are not necessarily null-terminated.
+    /// @return Const pointer to the viewed characters.
+    constexpr const char* Characters() const { return characters; }
+
+    /// @brief Returns a view of at most count characters starting at the
+    /// specified offset. Both arguments are clamped to the bounds of the view.
+    /// @param offset The index of the first character of the subview.
+    /// @param count The maximum number of characters of the subview.
+    /// @return A view of the requested characters.
+    DynamicStringView Substring(size_t offset, size_t count) const
+    {
+        offset = offset < length ? offset : length;
+        count = count < length - offset ? count : length - offset;
+        return DynamicStringView(characters + offset, count);
+    }
+
+    /// @brief Returns a view of the characters without the leading and trailing
+    /// whitespace, whitespace being what std::isspace tells in the "C" locale.
+    /// @return A view of the trimmed characters.
+    DynamicStringView Trim() const { return TrimLeft().TrimRight(); }
+
+    /// @brief Returns a view of the characters without the leading whitespace.
+    /// @return A view of the trimmed characters.
+    DynamicStringView TrimLeft() const
+    {
+        size_t skipped = DynamicStringTransform::CountLeadingWhitespace(characters, length);
+        return DynamicStringView(characters + skipped, length - skipped);
+    }
+
+    /// @brief Returns a view of the characters without the trailing whitespace.
+    /// @return A view of the trimmed characters.
+    DynamicStringView TrimRight() const
+    {
+        return DynamicStringView(characters, length - DynamicStringTransform::CountTrailingWhitespace(characters, length));
+    }
+
+    /// @brief Returns a value indicating whether all the viewed characters are ASCII.
+    /// @return true if no character has its high bit set.
+    bool IsAscii() const { return DynamicStringTransform::IsAscii(characters, length); }
+
+    /// @brief Returns a value indicating whether all the viewed characters are
+    /// whitespace. An empty view is all whitespace.
+    /// @return true if the view has no other characters than whitespace.
+    bool IsAllWhitespace() const
+    {
+        return DynamicStringTransform::CountLeadingWhitespace(characters, length) == length;
+    }
+
+    /// @brief Returns a value indicating whether the characters in this view
+    /// are equal to the characters in the specified view.
+    /// @param other A view to compare with this view.
+    /// @return true if both views have equal char sequences.
+    bool Equals(DynamicStringView other) const
+    {
+        return length == other.length
+            && memcmp(characters, other.characters, length) == 0;
+    }
+
+    /// @brief Compares the characters of this view with the characters of the 
+    /// specified view lexicographically, byte by byte as unsigned values.
+    /// @param other A view to compare with this view.
+    /// @return A negative value if this view goes first, zero if both views are equal,
+    /// and a positive value if this view goes after the other one.
+    int Compare(DynamicStringView other) const
+    {
+        size_t common = length < other.length ? length : other.length;
+        int result = memcmp(characters, other.characters, common);
+        if (result != 0)
+            return result;
+        return length < other.length ? -1 : (length > other.length ? 1 : 0);
+    }
+
+    /// @brief Returns a 64-bit hash of the viewed characters. Characters
+    /// are mixed eight at a time, so equal sequences hash equally
+    /// regardless of where they are stored.
+    /// @return The hash of the viewed characters.
+    uint64_t Hash() const
+    {
+        const uint64_t multiplier = 0x9E3779B97F4A7C15ull;
+        uint64_t hash = length * multiplier;
+        const char* current = characters;
+        size_t remaining = length;
+
+        for (; remaining >= 8; remaining -= 8, current += 8)
+        {
+            uint64_t block;
+            memcpy(&block, current, 8);
+            hash = (hash ^ block) * multiplier;
+            hash ^= hash >> 29;
+        }
+        if (remaining > 0)
+        {
+            uint64_t block = 0;
+            memcpy(&block, current, remaining);
+            hash = (hash ^ block) * multiplier;
+        }
+
+        // finalizing so that every input bit affects every output bit
+        hash ^= hash >> 32;
+        hash *= 0xD6E8FEB86659FD93ull;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    /// @brief Returns a read-only iterator that points to the first
+    /// character in the view.
+    /// @return A read-only iterator that points to the first character in the view.
+    constexpr Iterator begin() const { return characters; }
+
+    /// @brief Returns a read-only iterator that points one past the
+    /// last character in the view.
+    /// @return A read-only iterator that points one past the last character in the view.
+    constexpr Iterator end() const { return characters + length; }
+
+public:
+    /// @brief Returns a character of the view at the specified index.
+    /// @param index The index within the view at which the character will be returned.
+    /// @return Character of the view at the specified index.
+    const char& operator[](size_t index) const
+    {
+        assert(index < length);
+        return characters[index];
+    }
+
+private:
+    const char* characters = "";
+    size_t length = 0;
+};
+
+// Comparison operators outside of the class.
+// Views are also compared with C-strings directly, so that comparing
+// a view with a literal is not ambiguous with dynamic string conversions.
+
+inline bool operator==(DynamicStringView first, DynamicStringView second) { return first.Equals(second); }
+inline bool operator==(DynamicStringView first, const char* second) { return first.Equals(DynamicStringView(second)); }
+inline bool operator==(const char* first, DynamicStringView second) { return DynamicStringView(first).Equals(second); }
+inline bool operator!=(DynamicStringView first, DynamicStringView second) { return !first.Equals(second); }
+inline bool operator!=(DynamicStringView first, const char* second) { return !first.Equals(DynamicStringView(second)); }
+inline bool operator!=(const char* first, DynamicStringView second) { return !DynamicStringView(first).Equals(second); }
+inline bool operator<(DynamicStringView first, DynamicStringView second) { return first.Compare(second) < 0; }
+inline bool operator<(DynamicStringView first, const char* second) { return first.Compare(DynamicStringView(second)) < 0; }
+inline bool operator<(const char* first, DynamicStringView second) { return DynamicStringView(first).Compare(second) < 0; }
+inline bool operator<=(DynamicStringView first, DynamicStringView second) { return first.Compare(second) <= 0; }
+inline bool operator<=(DynamicStringView first, const char* second) { return first.Compare(DynamicStringView(second)) <= 0; }
+inline bool operator<=(const char* first, DynamicStringView second) { return DynamicStringView(first).Compare(second) <= 0; }
+inline bool operator>(DynamicStringView first, DynamicStringView second) { return first.Compare(second) > 0; }
+inline bool operator>(DynamicStringView first, const char* second) { return first.Compare(DynamicStringView(second)) > 0; }
+inline bool operator>(const char* first, DynamicStringView second) { return DynamicStringView(first).Compare(second) > 0; }
+inline bool operator>=(DynamicStringView first, DynamicStringView second) { return first.Compare(second) >= 0; }
+inline bool operator>=(DynamicStringView first, const char* second) { return first.Compare(DynamicStringView(second)) >= 0; }
+inline bool operator>=(const char* first, DynamicStringView second) { return DynamicStringView(first).Compare(second) >= 0; }
+
+/// @brief Pushes the viewed characters to the output stream.
+/// @param stream The output stream to accept the characters.
+/// @param view The view to be pushed to the output stream.
+/// @return The output stream containing the viewed characters.
+inline std::ostream& operator<<(std::ostream& stream, DynamicStringView view)
+{
+    return stream.write(view.Characters(), view.Length());
+}
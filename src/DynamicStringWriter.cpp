@@ -0,0 +1,172 @@
+#include "DynamicStringWriter.h"
+
+#include <vector>
+
+#ifdef DYNSTR_HAS_IOVEC
+#include <cerrno>
+#include <unistd.h>
+
+/// @brief The maximum number of pieces passed to a single vectored write.
+static constexpr size_t MAX_VECTORS = 1024;
+#else
+#include <io.h>
+#endif
+
+constexpr int DynamicStringWriter::STANDARD_OUTPUT;
+constexpr size_t DynamicStringWriter::DEFAULT_BUFFER_CAPACITY;
+
+DynamicStringWriter::DynamicStringWriter(int fileDescriptor, size_t bufferCapacity)
+    : buffer(new char[bufferCapacity > 0 ? bufferCapacity : DEFAULT_BUFFER_CAPACITY]),
+    capacity(bufferCapacity > 0 ? bufferCapacity : DEFAULT_BUFFER_CAPACITY),
+    fileDescriptor(fileDescriptor)
+{ }
+
+DynamicStringWriter::DynamicStringWriter(std::ostream& stream, size_t bufferCapacity)
+    : buffer(new char[bufferCapacity > 0 ? bufferCapacity : DEFAULT_BUFFER_CAPACITY]),
+    capacity(bufferCapacity > 0 ? bufferCapacity : DEFAULT_BUFFER_CAPACITY),
+    stream(&stream)
+{ }
+
+DynamicStringWriter::~DynamicStringWriter()
+{
+    Flush();
+    delete[] buffer;
+}
+
+DynamicStringWriter& DynamicStringWriter::Write(char character)
+{
+    if (length == capacity)
+        WriteOut(nullptr, 0);
+
+    buffer[length++] = character;
+    return *this;
+}
+
+DynamicStringWriter& DynamicStringWriter::Write(DynamicStringView view)
+{
+    if (view.Length() <= capacity - length)
+    {
+        memcpy(buffer + length, view.Characters(), view.Length() * sizeof(char));
+        length += view.Length();
+    }
+    else if (view.Length() < capacity / 4)
+    {
+        // a small piece is cheaper to copy into the emptied buffer
+        WriteOut(nullptr, 0);
+        memcpy(buffer, view.Characters(), view.Length() * sizeof(char));
+        length = view.Length();
+    }
+    else
+        WriteOut(&view, 1);
+
+    return *this;
+}
+
+DynamicStringWriter& DynamicStringWriter::WriteLine(DynamicStringView view)
+{
+    Write(view);
+    return Write('\n');
+}
+
+DynamicStringWriter& DynamicStringWriter::Write(const DynamicStringBuilder& builder)
+{
+    if (builder.Length() < capacity / 4)
+    {
+        for (DynamicStringView segment : builder.Segments())
+            Write(segment);
+        return *this;
+    }
+
+    std::vector<DynamicStringView> segments = builder.Segments();
+    WriteOut(segments.data(), segments.size());
+    return *this;
+}
+
+bool DynamicStringWriter::Flush()
+{
+    if (length > 0)
+        WriteOut(nullptr, 0);
+    if (stream)
+        stream->flush();
+
+    return !failed;
+}
+
+void DynamicStringWriter::WriteOut(const DynamicStringView* pieces, size_t count)
+{
+    if (failed)
+    {
+        length = 0;
+        return;
+    }
+
+    if (stream)
+    {
+        stream->write(buffer, length);
+        for (size_t i = 0; i < count; i++)
+            stream->write(pieces[i].Characters(), pieces[i].Length());
+        writeCount++;
+        failed = !stream->good();
+        length = 0;
+        return;
+    }
+
+#ifdef DYNSTR_HAS_IOVEC
+    std::vector<iovec> vectors;
+    vectors.reserve(count + 1);
+    if (length > 0)
+        vectors.push_back(iovec { buffer, length });
+    for (size_t i = 0; i < count; i++)
+        if (!pieces[i].IsEmpty())
+            vectors.push_back(iovec { const_cast<char*>(pieces[i].Characters()), pieces[i].Length() });
+
+    iovec* current = vectors.data();
+    size_t remaining = vectors.size();
+    while (remaining > 0)
+    {
+        ssize_t written = writev(fileDescriptor, current,
+            static_cast<int>(remaining < MAX_VECTORS ? remaining : MAX_VECTORS));
+        writeCount++;
+        if (written < 0)
+        {
+            if (errno == EINTR) continue;
+            failed = true;
+            break;
+        }
+
+        // skipping the pieces written completely and the written part of the next one
+        size_t skipped = static_cast<size_t>(written);
+        while (remaining > 0 && skipped >= current->iov_len)
+        {
+            skipped -= current->iov_len;
+            current++;
+            remaining--;
+        }
+        if (remaining > 0)
+        {
+            current->iov_base = static_cast<char*>(current->iov_base) + skipped;
+            current->iov_len -= skipped;
+        }
+    }
+#else
+    auto writeAll = [this](const char* characters, size_t size) {
+        while (size > 0 && !failed)
+        {
+            int written = _write(fileDescriptor, characters, static_cast<unsigned>(size));
+            writeCount++;
+            if (written < 0)
+                failed = true;
+            else
+            {
+                characters += written;
+                size -= written;
+            }
+        }
+    };
+    writeAll(buffer, length);
+    for (size_t i = 0; i < count; i++)
+        writeAll(pieces[i].Characters(), pieces[i].Length());
+#endif
+
+    length = 0;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <ostream>
+
+#include "DynamicString.h"
+#include "DynamicStringBuilder.h"
+
+/// @brief Represents a buffered sink of characters for a file descriptor or
+/// an output stream. Small pieces are gathered in a large buffer, while large
+/// pieces are written directly together with the buffer in a single vectored
+/// write (writev() on POSIX systems), so the number of system calls depends
+/// on the amount of output rather than on the number of pieces.
+class DynamicStringWriter
+{
+public:
+    /// @brief The file descriptor of the standard output.
+    static constexpr int STANDARD_OUTPUT = 1;
+
+public:
+    /// @brief Constructor that creates a writer to the specified file descriptor.
+    /// @param fileDescriptor The file descriptor to write to; it is not closed by the writer.
+    /// @param bufferCapacity The number of characters gathered before they are written.
+    explicit DynamicStringWriter(int fileDescriptor, size_t bufferCapacity = DEFAULT_BUFFER_CAPACITY);
+
+    /// @brief Constructor that creates a writer to the specified output stream.
+    /// @param stream The output stream to write to.
+    /// @param bufferCapacity The number of characters gathered before they are written.
+    explicit DynamicStringWriter(std::ostream& stream, size_t bufferCapacity = DEFAULT_BUFFER_CAPACITY);
+
+    DynamicStringWriter(const DynamicStringWriter& other) = delete;
+
+    DynamicStringWriter& operator=(const DynamicStringWriter& other) = delete;
+
+    /// @brief Flushes the gathered characters and destroys the writer.
+    ~DynamicStringWriter();
+
+public:
+    /// @brief Writes the specified character.
+    /// @param character The character to be written.
+    /// @return A reference to this writer.
+    DynamicStringWriter& Write(char character);
+
+    /// @brief Writes the viewed characters.
+    /// @param view The characters to be written.
+    /// @return A reference to this writer.
+    DynamicStringWriter& Write(DynamicStringView view);
+
+    /// @brief Writes the viewed characters followed by a new-line character.
+    /// @param view The characters to be written.
+    /// @return A reference to this writer.
+    DynamicStringWriter& WriteLine(DynamicStringView view);
+
+    /// @brief Writes all the characters appended to the builder. The chunks of
+    /// a large builder are written directly without copying them.
+    /// @param builder The builder whose characters are to be written.
+    /// @return A reference to this writer.
+    DynamicStringWriter& Write(const DynamicStringBuilder& builder);
+
+    /// @brief Writes all the gathered characters out.
+    /// @return true if all the characters have been written so far.
+    bool Flush();
+
+    /// @brief Returns a value indicating whether no write has failed so far.
+    /// @return true if no write has failed so far.
+    bool IsGood() const { return !failed; }
+
+    /// @brief Returns the number of writes done to the file descriptor or stream.
+    /// @return The number of writes done to the file descriptor or stream.
+    size_t WriteCount() const { return writeCount; }
+
+private:
+    /// @brief Writes the gathered characters followed by the specified pieces
+    /// in as few vectored writes as possible and empties the buffer.
+    /// @param pieces The pieces to be written after the buffer.
+    /// @param count The number of pieces.
+    void WriteOut(const DynamicStringView* pieces, size_t count);
+
+private:
+    static constexpr size_t DEFAULT_BUFFER_CAPACITY = 64 * 1024;
+
+    char* buffer;
+    size_t length = 0;
+    size_t capacity;
+
+    int fileDescriptor = -1;
+    std::ostream* stream = nullptr;
+
+    bool failed = false;
+    size_t writeCount = 0;
+};
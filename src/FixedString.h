@@ -0,0 +1,289 @@
+#pragma once
+
+#include <assert.h>
+#include <cstddef>
+#include <cstdint>
+
+#include "DynamicStringView.h"
+
+/// @brief A list of indices of characters, which lets constructors
+/// initialize character arrays one character per index.
+template <size_t... Indices>
+struct FixedStringIndices { };
+
+/// @brief Joins two lists of indices, shifting the second list past the first one.
+template <typename First, typename Second>
+struct JoinFixedStringIndices;
+
+template <size_t... First, size_t... Second>
+struct JoinFixedStringIndices<FixedStringIndices<First...>, FixedStringIndices<Second...>>
+{
+    using Type = FixedStringIndices<First..., (sizeof...(First) + Second)...>;
+};
+
+/// @brief Makes the list of indices from zero to count - 1. The halves are made
+/// separately, so the depth of the instantiations grows logarithmically.
+template <size_t Count>
+struct MakeFixedStringIndices
+{
+    using Type = typename JoinFixedStringIndices<
+        typename MakeFixedStringIndices<Count / 2>::Type,
+        typename MakeFixedStringIndices<Count - Count / 2>::Type>::Type;
+};
+
+template <>
+struct MakeFixedStringIndices<0> { using Type = FixedStringIndices<>; };
+
+template <>
+struct MakeFixedStringIndices<1> { using Type = FixedStringIndices<0>; };
+
+/// @brief A string of exactly N characters stored in place, which can be created,
+/// compared, concatenated and hashed at compile time. Fixed strings need no
+/// memory of their own, so constant fixed strings are initialized before
+/// the program starts and tables of them cost nothing at startup.
+///
+/// Fixed strings are read like views: they convert to DynamicStringView,
+/// so every function accepting views, including the comparators of
+/// DynamicStringComparator::Views, accepts them as well.
+template <size_t N>
+class FixedString
+{
+public:
+    using Iterator = const char*;
+
+public:
+    /// @brief Constructor that creates a fixed string of the characters of a
+    /// string literal, whose length is known from its type.
+    /// @param value The string literal of N characters.
+    constexpr FixedString(const char (&value)[N + 1])
+        : FixedString(value, typename MakeFixedStringIndices<N>::Type())
+    { }
+
+public:
+    /// @brief Returns the number of characters within the string
+    /// without a null-terminating character.
+    /// @return The number of characters within the string.
+    constexpr size_t Length() const { return N; }
+
+    /// @brief Returns a value indicating whether the string has no characters.
+    /// @return true if the length of the string is zero.
+    constexpr bool IsEmpty() const { return N == 0; }
+
+    /// @brief Returns const pointer to null-terminated contents of the string.
+    /// @return Const pointer to null-terminated contents of the string.
+    constexpr const char* Characters() const { return characters; }
+
+    /// @brief Returns a read-only iterator that points to the first character.
+    /// @return A read-only iterator that points to the first character.
+    constexpr Iterator begin() const { return characters; }
+
+    /// @brief Returns a read-only iterator that points one past the last character.
+    /// @return A read-only iterator that points one past the last character.
+    constexpr Iterator end() const { return characters + N; }
+
+    /// @brief Returns a value indicating whether the characters in this instance
+    /// are equal to the characters of the specified fixed string.
+    /// @param other A fixed string to compare with this one.
+    /// @return true if both strings have equal char sequences.
+    template <size_t M>
+    constexpr bool Equals(const FixedString<M>& other) const
+    {
+        return N == M && CompareRange(characters, other.Characters(), 0, N) == 0;
+    }
+
+    /// @brief Returns a value indicating whether the characters in this instance
+    /// are equal to the viewed characters.
+    /// @param other A view to compare with this string.
+    /// @return true if this instance and the specified view have equal char sequences.
+    bool Equals(DynamicStringView other) const { return DynamicStringView(*this).Equals(other); }
+
+    /// @brief Compares the characters of this instance with the characters of the
+    /// specified fixed string lexicographically, byte by byte as unsigned values,
+    /// the same way DynamicStringView::Compare() does.
+    /// @param other A fixed string to compare with this one.
+    /// @return A negative value if this string goes first, zero if both are equal,
+    /// and a positive value if this string goes after the other one.
+    template <size_t M>
+    constexpr int Compare(const FixedString<M>& other) const
+    {
+        return FirstNonZero(
+            CompareRange(characters, other.Characters(), 0, N < M ? N : M),
+            N < M ? -1 : (N > M ? 1 : 0));
+    }
+
+    /// @brief Compares the characters of this instance with the viewed characters
+    /// lexicographically, byte by byte as unsigned values.
+    /// @param other The characters to compare with this string.
+    /// @return A negative value if this string goes first, zero if both are equal,
+    /// and a positive value if this string goes after the other one.
+    int Compare(DynamicStringView other) const { return DynamicStringView(*this).Compare(other); }
+
+    /// @brief Returns the 64-bit hash of the characters, which is equal to the
+    /// hash DynamicStringView::Hash() returns for the same characters, so
+    /// hashes computed at compile time can be looked up by views at run time.
+    /// @return The hash of the characters.
+    constexpr uint64_t Hash() const
+    {
+        return Finalize(HashBlocks(N * HASH_MULTIPLIER, 0));
+    }
+
+    /// @brief Returns a fixed string of the characters of this instance
+    /// followed by the characters of the specified fixed string.
+    /// @param other The fixed string to be concatenated.
+    /// @return The concatenated string.
+    template <size_t M>
+    constexpr FixedString<N + M> Concatenate(const FixedString<M>& other) const
+    {
+        return FixedString<N + M>(*this, other,
+            typename MakeFixedStringIndices<N>::Type(), typename MakeFixedStringIndices<M>::Type());
+    }
+
+public:
+    /// @brief Returns a character of the string at the specified index.
+    /// @param index The index within the string at which the character will be returned.
+    /// @return Character of the string at the specified index.
+    constexpr const char& operator[](size_t index) const
+    {
+        return assert(index < N), characters[index];
+    }
+
+    /// @brief Returns a view of the characters of the string.
+    constexpr operator DynamicStringView() const
+    {
+        return DynamicStringView(characters, N);
+    }
+
+private:
+    template <size_t M>
+    friend class FixedString;
+
+    template <size_t... Indices>
+    constexpr FixedString(const char (&value)[N + 1], FixedStringIndices<Indices...>)
+        : characters { value[Indices]..., '\0' }
+    { }
+
+    template <size_t First, size_t... FirstIndices, size_t... SecondIndices>
+    constexpr FixedString(const FixedString<First>& first, const FixedString<N - First>& second,
+        FixedStringIndices<FirstIndices...>, FixedStringIndices<SecondIndices...>)
+        : characters { first.characters[FirstIndices]..., second.characters[SecondIndices]..., '\0' }
+    { }
+
+    static constexpr int FirstNonZero(int first, int second) { return first != 0 ? first : second; }
+
+    /// @brief Compares count characters from the offset on. The halves are compared
+    /// separately, so the depth of the recursion grows logarithmically.
+    static constexpr int CompareRange(const char* first, const char* second, size_t offset, size_t count)
+    {
+        return count == 0 ? 0
+            : count == 1 ? static_cast<unsigned char>(first[offset]) - static_cast<unsigned char>(second[offset])
+            : FirstNonZero(
+                CompareRange(first, second, offset, count / 2),
+                CompareRange(first, second, offset + count / 2, count - count / 2));
+    }
+
+    static constexpr uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+    /// @brief Reads count characters from the offset on as memcpy() does into
+    /// a zeroed 64-bit block, which depends on the byte order of the target.
+    constexpr uint64_t Block(size_t offset, size_t count, size_t index = 0) const
+    {
+        return index == count ? 0 :
+            (static_cast<uint64_t>(static_cast<unsigned char>(characters[offset + index]))
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+                << (8 * (7 - index)))
+#else
+                << (8 * index))
+#endif
+            | Block(offset, count, index + 1);
+    }
+
+    static constexpr uint64_t Spread(uint64_t hash) { return hash ^ (hash >> 29); }
+
+    constexpr uint64_t HashBlocks(uint64_t hash, size_t offset) const
+    {
+        return N - offset >= 8 ? HashBlocks(Spread((hash ^ Block(offset, 8)) * HASH_MULTIPLIER), offset + 8)
+            : N - offset > 0 ? (hash ^ Block(offset, N - offset)) * HASH_MULTIPLIER
+            : hash;
+    }
+
+    static constexpr uint64_t Finalize(uint64_t hash)
+    {
+        return FinalizeHigh(FinalizeHigh(hash) * 0xD6E8FEB86659FD93ull);
+    }
+
+    static constexpr uint64_t FinalizeHigh(uint64_t hash) { return hash ^ (hash >> 32); }
+
+private:
+    char characters[N + 1];
+};
+
+template <size_t N>
+constexpr uint64_t FixedString<N>::HASH_MULTIPLIER;
+
+/// @brief Creates a fixed string of the characters of a string literal,
+/// taking the length from the type of the literal.
+/// @param value The string literal.
+/// @return The fixed string of the characters of the literal.
+template <size_t N>
+constexpr FixedString<N - 1> MakeFixedString(const char (&value)[N])
+{
+    return FixedString<N - 1>(value);
+}
+
+#if __cplusplus >= 201703L
+template <size_t N>
+FixedString(const char (&value)[N]) -> FixedString<N - 1>;
+#endif
+
+// Comparison and concatenation operators outside of the class.
+// Fixed strings are also compared with string literals directly, so that
+// such comparisons are evaluated at compile time as well.
+
+template <size_t N, size_t M>
+constexpr bool operator==(const FixedString<N>& first, const FixedString<M>& second) { return first.Equals(second); }
+template <size_t N, size_t M>
+constexpr bool operator==(const FixedString<N>& first, const char (&second)[M]) { return first.Equals(FixedString<M - 1>(second)); }
+template <size_t N, size_t M>
+constexpr bool operator==(const char (&first)[N], const FixedString<M>& second) { return second.Equals(FixedString<N - 1>(first)); }
+template <size_t N, size_t M>
+constexpr bool operator!=(const FixedString<N>& first, const FixedString<M>& second) { return !first.Equals(second); }
+template <size_t N, size_t M>
+constexpr bool operator!=(const FixedString<N>& first, const char (&second)[M]) { return !first.Equals(FixedString<M - 1>(second)); }
+template <size_t N, size_t M>
+constexpr bool operator!=(const char (&first)[N], const FixedString<M>& second) { return !second.Equals(FixedString<N - 1>(first)); }
+template <size_t N, size_t M>
+constexpr bool operator<(const FixedString<N>& first, const FixedString<M>& second) { return first.Compare(second) < 0; }
+template <size_t N, size_t M>
+constexpr bool operator<=(const FixedString<N>& first, const FixedString<M>& second) { return first.Compare(second) <= 0; }
+template <size_t N, size_t M>
+constexpr bool operator>(const FixedString<N>& first, const FixedString<M>& second) { return first.Compare(second) > 0; }
+template <size_t N, size_t M>
+constexpr bool operator>=(const FixedString<N>& first, const FixedString<M>& second) { return first.Compare(second) >= 0; }
+
+template <size_t N, size_t M>
+constexpr FixedString<N + M> operator+(const FixedString<N>& first, const FixedString<M>& second)
+{
+    return first.Concatenate(second);
+}
+
+template <size_t N, size_t M>
+constexpr FixedString<N + M - 1> operator+(const FixedString<N>& first, const char (&second)[M])
+{
+    return first.Concatenate(FixedString<M - 1>(second));
+}
+
+template <size_t N, size_t M>
+constexpr FixedString<N - 1 + M> operator+(const char (&first)[N], const FixedString<M>& second)
+{
+    return FixedString<N - 1>(first).Concatenate(second);
+}
+
+/// @brief Pushes the characters of the fixed string to the output stream.
+/// @param stream The output stream to accept the characters.
+/// @param string The fixed string to be pushed to the output stream.
+/// @return The output stream containing the characters.
+template <size_t N>
+std::ostream& operator<<(std::ostream& stream, const FixedString<N>& string)
+{
+    return stream.write(string.Characters(), N);
+}
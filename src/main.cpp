@@ -4,11 +4,48 @@
 
 #include "DynamicString.h"
 #include "DynamicStringComparator.h"
+#include "DynamicStringPipeline.h"
+#include "DynamicStringSorter.h"
+#include "DynamicStringWriter.h"
 
-int main()
+int main(int argc, char** argv)
 {
-    std::vector<DynamicString> strings;
-    strings.reserve(10);
+    DynamicStringSorter::Options options;
+    if (!DynamicStringSorter::ParseOptions(argc, argv, options))
+    {
+        std::cerr << "Usage: " << argv[0] << " [--top K] [--unique] [--count] [--fold] [--threads N]" << std::endl;
+        return 1;
+    }
+
+    if (options.threads > 0)
+    {
+        // reading overlaps with sorting, and merging overlaps with writing
+        DynamicStringPipeline pipeline(options.fold
+            ? DynamicStringComparator::Views::Lexicographical_Reversed
+            : DynamicStringComparator::Views::Lexicographical_Reversed_CaseInsensitive, options);
+
+        std::cout << "Enter some strings and press Enter:" << std::endl;
+        if (!pipeline.ReadFrom(DynamicStringPipeline::STANDARD_INPUT))
+        {
+            std::cerr << "Failed to read the input" << std::endl;
+            return 1;
+        }
+
+        std::cout << "Your strings sorted lexicographically in reverse & case insensitive:" << std::endl;
+        DynamicStringWriter writer(DynamicStringWriter::STANDARD_OUTPUT);
+        pipeline.WriteTo(writer);
+        if (!writer.Flush())
+        {
+            std::cerr << "Failed to write the output" << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    // folded strings are compared by their copies in lower case, as plain bytes
+    DynamicStringSorter sorter(options.fold
+        ? DynamicStringComparator::Lexicographical_Reversed
+        : DynamicStringComparator::Lexicographical_Reversed_CaseInsensitive, options);
 
     std::cout << "Enter some strings and press Enter:" << std::endl;
     while (true)
@@ -17,15 +54,17 @@ int main()
         std::cin >> string;
 
         if (string.Equals("")) break;
-        strings.push_back(std::move(string));
+        sorter.Add(std::move(string));
     }
 
-    std::sort(strings.begin(), strings.end(),
-        DynamicStringComparator::Lexicographical_Reversed_CaseInsensitive);
-
     std::cout << "Your strings sorted lexicographically in reverse & case insensitive:" << std::endl;
-    for (const DynamicString& string : strings)
+
+    // the lines are gathered and written in large batches instead of being flushed one by one
+    DynamicStringWriter writer(DynamicStringWriter::STANDARD_OUTPUT);
+    sorter.WriteTo(writer);
+    if (!writer.Flush())
     {
-        std::cout << string << std::endl;
+        std::cerr << "Failed to write the output" << std::endl;
+        return 1;
     }
-}
\ No newline at end of file
+}
@@ -109,4 +109,26 @@ TEST(DynstrTest, StringMoves)
     EXPECT_EQ(string.Characters(), nullptr);
     EXPECT_EQ(string.Length(), 0);
     EXPECT_EQ(string.Capacity(), 0);
-}
\ No newline at end of file
+}
+TEST(DynstrTest, AllocatesCharacters_AfterNullConstruction)
+{
+    DynamicString string(static_cast<const char*>(nullptr));
+
+    EXPECT_EQ(string.Characters(), nullptr);
+    EXPECT_EQ(string.Length(), 0);
+    EXPECT_EQ(string.Capacity(), 0);
+
+    string.Add('b');
+    string.Insert(0, 'a');
+    EXPECT_STREQ(string.Characters(), "ab");
+    EXPECT_EQ(string.Length(), 2);
+
+    DynamicString other(static_cast<const char*>(nullptr));
+    other.Concatenate("cd");
+    EXPECT_STREQ(other.Characters(), "cd");
+    EXPECT_EQ(other.Length(), 2);
+
+    string = static_cast<const char*>(nullptr);
+    string.Add('e');
+    EXPECT_STREQ(string.Characters(), "e");
+}
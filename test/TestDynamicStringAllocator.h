@@ -0,0 +1,161 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringAllocator.h"
+
+#ifndef DYNSTR_DISABLE_POOL
+TEST(DynstrAllocatorTest, RoundsSmallBlocks_UpToSizeClasses)
+{
+    EXPECT_EQ(DynamicStringAllocator::BlockSize(1), 16);
+    EXPECT_EQ(DynamicStringAllocator::BlockSize(16), 16);
+    EXPECT_EQ(DynamicStringAllocator::BlockSize(17), 32);
+    EXPECT_EQ(DynamicStringAllocator::BlockSize(4096), 4096);
+    EXPECT_EQ(DynamicStringAllocator::BlockSize(4097), 4097);
+}
+
+TEST(DynstrAllocatorTest, ReusesFreedBlocks_OfSameClass)
+{
+    char* first = DynamicStringAllocator::Allocate(20);
+    DynamicStringAllocator::Deallocate(first, 20);
+    char* second = DynamicStringAllocator::Allocate(30);
+
+    EXPECT_EQ(first, second);
+    DynamicStringAllocator::Deallocate(second, 30);
+}
+#endif
+
+TEST(DynstrAllocatorTest, GrowsStringsWithinBlock_KeepingCapacities)
+{
+    DynamicString string;
+    const char* characters = string.Characters();
+    for (char character : { 'a', 'b', 'c', 'd', 'e' })
+        string.Add(character);
+
+    EXPECT_EQ(string.Capacity(), 8);
+    EXPECT_STREQ(string.Characters(), "abcde");
+#ifndef DYNSTR_DISABLE_POOL
+    EXPECT_EQ(string.Characters(), characters);
+#else
+    (void)characters;
+#endif
+}
+
+TEST(DynstrAllocatorTest, FreesStrings_OnOtherThreads)
+{
+    const size_t threadCount = 4;
+    const size_t stringCount = 20000;
+    std::vector<std::vector<DynamicString>> produced(threadCount);
+
+    std::vector<std::thread> producers;
+    for (size_t t = 0; t < threadCount; t++)
+        producers.emplace_back([&produced, t] {
+            for (size_t i = 0; i < stringCount; i++)
+            {
+                DynamicString string;
+                for (size_t length = (i * 7 + t) % 300; length > 0; length--)
+                    string.Add(static_cast<char>('a' + t));
+                produced[t].push_back(std::move(string));
+            }
+        });
+    for (std::thread& producer : producers)
+        producer.join();
+
+    // every thread frees the strings another thread has allocated
+    std::vector<std::thread> consumers;
+    for (size_t t = 0; t < threadCount; t++)
+        consumers.emplace_back([&produced, t] {
+            std::vector<DynamicString>& strings = produced[(t + 1) % threadCount];
+            for (size_t i = 0; i < strings.size(); i++)
+            {
+                char expected = static_cast<char>('a' + (t + 1) % threadCount);
+                EXPECT_EQ(strings[i].Length(), (i * 7 + (t + 1) % threadCount) % 300);
+                for (char character : strings[i])
+                    ASSERT_EQ(character, expected);
+            }
+            strings.clear();
+        });
+    for (std::thread& consumer : consumers)
+        consumer.join();
+}
+
+TEST(DynstrAllocatorTest, GrowsHugeStrings_KeepingCharacters)
+{
+    const size_t length = 3 * DynamicStringAllocator::MIN_HUGE_SIZE;
+    std::vector<char> piece(64 * 1024);
+    for (size_t i = 0; i < piece.size(); i++)
+        piece[i] = static_cast<char>('a' + i % 26);
+
+    DynamicString string;
+    while (string.Length() < length)
+        string.Concatenate(piece.data(), piece.size());
+
+    ASSERT_EQ(string.Length(), length);
+    EXPECT_GE(string.Capacity(), length);
+    for (size_t i = 0; i < string.Length(); i++)
+        ASSERT_EQ(string[i], piece[i % piece.size()]);
+    EXPECT_EQ(string.Characters()[length], '\0');
+}
+
+TEST(DynstrAllocatorTest, ShrinksHugeStrings_ToTheirLength)
+{
+    DynamicString string;
+    string.Reserve(4 * DynamicStringAllocator::MIN_HUGE_SIZE);
+    for (size_t i = 0; i < DynamicStringAllocator::MIN_HUGE_SIZE + 10; i++)
+        string.Add(static_cast<char>('a' + i % 26));
+
+    string.ShrinkToFit();
+
+    EXPECT_EQ(string.Capacity(), DynamicStringAllocator::MIN_HUGE_SIZE + 10);
+    EXPECT_EQ(string[DynamicStringAllocator::MIN_HUGE_SIZE + 9], static_cast<char>('a' + (DynamicStringAllocator::MIN_HUGE_SIZE + 9) % 26));
+    string.Add('!');
+    EXPECT_EQ(string[string.Length() - 1], '!');
+}
+
+TEST(DynstrAllocatorTest, ShrinksSmallStrings_ToTheirLength)
+{
+    DynamicString string("abc");
+    string.Reserve(1000);
+    string.ShrinkToFit();
+
+    EXPECT_EQ(string.Capacity(), 3);
+    EXPECT_STREQ(string.Characters(), "abc");
+
+    DynamicString empty;
+    empty.Reserve(100);
+    empty.ShrinkToFit();
+    EXPECT_EQ(empty.Capacity(), 1);
+    EXPECT_STREQ(empty.Characters(), "");
+}
+
+TEST(DynstrAllocatorTest, CopiesAndMovesHugeStrings)
+{
+    DynamicString string;
+    string.Reserve(2 * DynamicStringAllocator::MIN_HUGE_SIZE);
+    for (size_t i = 0; i < 2 * DynamicStringAllocator::MIN_HUGE_SIZE; i++)
+        string.Add(static_cast<char>('a' + i % 26));
+
+    DynamicString copy(string);
+    EXPECT_EQ(copy, string);
+    EXPECT_NE(copy.Characters(), string.Characters());
+
+    const char* characters = string.Characters();
+    DynamicString moved(std::move(string));
+    EXPECT_EQ(moved.Characters(), characters);
+    EXPECT_EQ(moved, copy);
+}
+
+#ifdef DYNSTR_HAS_MMAP
+TEST(DynstrAllocatorTest, RoundsHugeBlocks_ToPages)
+{
+    size_t size = DynamicStringAllocator::MIN_HUGE_SIZE + 1;
+    size_t blockSize = DynamicStringAllocator::BlockSize(size);
+
+    EXPECT_GE(blockSize, size);
+    EXPECT_EQ(blockSize % 4096, 0);
+    EXPECT_LT(blockSize - size, 64 * 1024);
+}
+#endif
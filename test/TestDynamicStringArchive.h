@@ -0,0 +1,115 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringArchive.h"
+#include "DynamicStringWriter.h"
+
+static std::string ArchiveOf(const std::vector<DynamicString>& strings)
+{
+    std::ostringstream stream;
+    DynamicStringWriter writer(stream);
+    DynamicStringArchiveWriter archiveWriter(writer);
+    for (const DynamicString& string : strings)
+        archiveWriter.Write(string);
+    EXPECT_TRUE(archiveWriter.Finish());
+    EXPECT_EQ(archiveWriter.Count(), strings.size());
+    return stream.str();
+}
+
+static std::string SaveArchiveFile(const std::string& contents)
+{
+    std::string path = ::testing::TempDir() + "dynstr-archive.bin";
+    std::ofstream file(path, std::ios::binary);
+    file.write(contents.data(), contents.size());
+    return path;
+}
+
+TEST(DynstrArchiveTest, LoadsWrittenStrings_AsViews)
+{
+    std::vector<DynamicString> strings = { "Hello", "", "World", "dynamic strings" };
+    for (int i = 0; i < 1000; i++)
+        strings.push_back(DynamicString(std::to_string(i * 7919).c_str()));
+
+    std::string path = SaveArchiveFile(ArchiveOf(strings));
+    DynamicStringArchive archive;
+    ASSERT_TRUE(archive.Open(path.c_str()));
+    ASSERT_EQ(archive.Size(), strings.size());
+
+    size_t index = 0;
+    for (DynamicStringView view : archive)
+    {
+        EXPECT_EQ(view, strings[index]) << "Strings differ at index " << index;
+        EXPECT_EQ(view.Characters()[view.Length()], '\0');
+        index++;
+    }
+
+    std::vector<DynamicString> copies = archive.ToStrings();
+    EXPECT_TRUE(copies == strings);
+
+    DynamicStringArchive moved = std::move(archive);
+    EXPECT_FALSE(archive.IsOpen());
+    EXPECT_EQ(moved[2], "World");
+
+    moved.Close();
+    EXPECT_EQ(moved.Size(), 0);
+    std::remove(path.c_str());
+}
+
+TEST(DynstrArchiveTest, LoadsEmptyArchive)
+{
+    std::string path = SaveArchiveFile(ArchiveOf({ }));
+    DynamicStringArchive archive;
+
+    EXPECT_TRUE(archive.Open(path.c_str()));
+    EXPECT_EQ(archive.Size(), 0);
+    EXPECT_TRUE(archive.begin() == archive.end());
+    std::remove(path.c_str());
+}
+
+TEST(DynstrArchiveTest, RejectsDamagedArchives)
+{
+    std::string contents = ArchiveOf({ "alpha", "beta", "gamma" });
+    DynamicStringArchive archive;
+
+    // a changed character is only noticed by the checksum
+    std::string changed = contents;
+    changed[17] = 'L';
+    std::string path = SaveArchiveFile(changed);
+    EXPECT_FALSE(archive.Open(path.c_str()));
+    EXPECT_TRUE(archive.Open(path.c_str(), false));
+    EXPECT_EQ(archive[0], "aLpha");
+
+    // a missing null character is noticed along with the checksum, even when
+    // the checksum matches; without it the views still end where they should
+    std::string unterminated = contents;
+    unterminated[16 + 5] = '!';
+    DynamicStringArchive::Checksum checksum;
+    checksum.Update(unterminated.data(), unterminated.size() - 16);
+    uint64_t value = checksum.Value();
+    unterminated.replace(unterminated.size() - 16, sizeof(value), reinterpret_cast<const char*>(&value), sizeof(value));
+    path = SaveArchiveFile(unterminated);
+    EXPECT_FALSE(archive.Open(path.c_str()));
+    EXPECT_FALSE(archive.IsOpen());
+    EXPECT_TRUE(archive.Open(path.c_str(), false));
+    EXPECT_EQ(archive[0], "alpha");
+    EXPECT_EQ(archive[1], "beta");
+
+    path = SaveArchiveFile(contents.substr(0, contents.size() - 1));
+    EXPECT_FALSE(archive.Open(path.c_str(), false));
+    EXPECT_FALSE(archive.IsOpen());
+
+    std::string newerVersion = contents;
+    newerVersion[8] = 2;
+    path = SaveArchiveFile(newerVersion);
+    EXPECT_FALSE(archive.Open(path.c_str(), false));
+
+    EXPECT_FALSE(archive.Open((::testing::TempDir() + "dynstr-missing.bin").c_str()));
+    std::remove(path.c_str());
+}
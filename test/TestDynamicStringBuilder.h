@@ -0,0 +1,73 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <climits>
+
+#include "DynamicString.h"
+#include "DynamicStringBuilder.h"
+
+TEST(DynstrBuilderTest, BuildsFromMixedPieces)
+{
+    DynamicString name = "world";
+    DynamicStringBuilder builder;
+    builder.Append("Hello, ").Append(name).Append('!')
+        .Append(DynamicStringView(" #123", 2)).Append(42);
+
+    DynamicString string = builder.Build();
+
+    EXPECT_STREQ(string.Characters(), "Hello, world! #42");
+    EXPECT_EQ(string.Length(), 17);
+    EXPECT_EQ(string.Capacity(), 17);
+    EXPECT_EQ(builder.Length(), 17);
+}
+
+TEST(DynstrBuilderTest, AppendsNumbers)
+{
+    DynamicStringBuilder builder;
+    builder.Append(LLONG_MIN).Append(' ').Append(ULLONG_MAX).Append(' ')
+        .Append(0).Append(' ').Append(0.1).Append(' ').Append(-2.5);
+
+    EXPECT_STREQ(builder.Build().Characters(),
+        "-9223372036854775808 18446744073709551615 0 0.1 -2.5");
+}
+
+TEST(DynstrBuilderTest, SpansPiecesAcrossChunks)
+{
+    DynamicStringBuilder builder(4);
+    builder.Append("abc").Append("defgh").Append('i').Append("0123456789");
+
+    std::vector<DynamicStringView> segments = builder.Segments();
+
+    ASSERT_EQ(segments.size(), 4);
+    EXPECT_TRUE(segments[0] == "abcd");
+    EXPECT_TRUE(segments[1] == "efgh");
+    EXPECT_TRUE(segments[2] == "i012");
+    EXPECT_TRUE(segments[3] == "3456789");
+    EXPECT_STREQ(builder.Build().Characters(), "abcdefghi0123456789");
+}
+
+TEST(DynstrBuilderTest, BuildsEmptyString)
+{
+    DynamicStringBuilder builder;
+    builder.Append("").Append(static_cast<const char*>(nullptr));
+
+    DynamicString string = builder.Build();
+
+    EXPECT_STREQ(string.Characters(), "");
+    EXPECT_EQ(string.Length(), 0);
+    EXPECT_TRUE(builder.Segments().empty());
+}
+
+TEST(DynstrBuilderTest, ClearsAndMoves)
+{
+    DynamicStringBuilder builder;
+    builder.Append("Hello");
+    DynamicStringBuilder other = std::move(builder);
+
+    EXPECT_EQ(builder.Length(), 0);
+    EXPECT_STREQ(other.Build().Characters(), "Hello");
+
+    other.Clear();
+    EXPECT_EQ(other.Length(), 0);
+    EXPECT_STREQ(other.Build().Characters(), "");
+}
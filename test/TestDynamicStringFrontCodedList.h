@@ -0,0 +1,96 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringFrontCodedList.h"
+
+static std::vector<std::string> SortedKeys(size_t count)
+{
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < count; i++)
+        keys.push_back("/usr/share/dynstr/keys/" + std::to_string(100000 + i * 3));
+    return keys;
+}
+
+TEST(DynstrFrontCodedListTest, DecodesEveryString_ByIndexAndSequentially)
+{
+    std::vector<std::string> keys = SortedKeys(1000);
+    keys.insert(keys.begin(), "");
+
+    DynamicStringFrontCodedList list(8);
+    size_t rawSize = 0;
+    for (const std::string& key : keys)
+    {
+        list.Append(DynamicStringView(key.c_str(), key.size()));
+        rawSize += key.size();
+    }
+
+    ASSERT_EQ(list.Size(), keys.size());
+    EXPECT_TRUE(list.IsOrdered());
+    EXPECT_LT(list.EncodedSize(), rawSize / 3);
+
+    DynamicString buffer;
+    for (size_t i = 0; i < keys.size(); i += 7)
+        EXPECT_EQ(list.Get(i, buffer), keys[i].c_str()) << "Strings differ at index " << i;
+    EXPECT_EQ(list.Get(keys.size() - 1), keys.back().c_str());
+
+    size_t index = 0;
+    for (DynamicStringView key : list)
+    {
+        EXPECT_EQ(key, keys[index].c_str()) << "Strings differ at index " << index;
+        index++;
+    }
+    EXPECT_EQ(index, keys.size());
+
+    DynamicStringFrontCodedList::Iterator iterator = list.begin();
+    DynamicStringFrontCodedList::Iterator previous = iterator++;
+    EXPECT_EQ(*previous, "");
+    EXPECT_EQ(*iterator, keys[1].c_str());
+    EXPECT_TRUE(++previous == iterator);
+}
+
+TEST(DynstrFrontCodedListTest, SearchesSortedStrings)
+{
+    std::vector<std::string> keys = SortedKeys(500);
+    DynamicStringFrontCodedList list;
+    for (const std::string& key : keys)
+        list.Append(key.c_str());
+
+    for (size_t i = 0; i < keys.size(); i++)
+        EXPECT_EQ(list.Find(keys[i].c_str()), i);
+
+    EXPECT_EQ(list.LowerBound("/usr/share/dynstr/keys/100001"), 1);
+    EXPECT_EQ(list.LowerBound("/a"), 0);
+    EXPECT_EQ(list.LowerBound("/z"), keys.size());
+    EXPECT_EQ(list.Find("/usr/share/dynstr/keys/100001"), DynamicString::NOT_FOUND);
+    EXPECT_EQ(list.Find("/z"), DynamicString::NOT_FOUND);
+}
+
+TEST(DynstrFrontCodedListTest, KeepsUnorderedStrings_WithoutSearching)
+{
+    DynamicStringFrontCodedList list(2);
+    const char* strings[] = { "banana", "band", "apple", "applet", "ban" };
+    EXPECT_TRUE(list.Append(strings[0]));
+    EXPECT_TRUE(list.Append(strings[1]));
+    EXPECT_FALSE(list.Append(strings[2]));
+    EXPECT_FALSE(list.Append(strings[3]));
+    EXPECT_FALSE(list.Append(strings[4]));
+
+    EXPECT_FALSE(list.IsOrdered());
+    for (size_t i = 0; i < 5; i++)
+        EXPECT_EQ(list.Get(i), strings[i]);
+
+    // the searches tell the list is unordered instead of giving wrong indices
+    EXPECT_EQ(list.LowerBound("apple"), DynamicString::NOT_FOUND);
+    EXPECT_EQ(list.Find("apple"), 2);
+    EXPECT_EQ(list.Find("ban"), 4);
+    EXPECT_EQ(list.Find("cherry"), DynamicString::NOT_FOUND);
+
+    list.Clear();
+    EXPECT_EQ(list.Size(), 0);
+    EXPECT_TRUE(list.begin() == list.end());
+    EXPECT_TRUE(list.IsOrdered());
+}
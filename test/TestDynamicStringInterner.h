@@ -0,0 +1,91 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringInterner.h"
+#include "DynamicStringBuilder.h"
+
+TEST(DynstrInternerTest, InternsEqualStrings_ToSameHandle)
+{
+    DynamicStringInterner interner(16);
+    DynamicString first = "Hello";
+    DynamicString second = "Hello";
+
+    DynamicStringInterner::Handle handle = interner.Intern(first);
+    
+    EXPECT_TRUE(handle.IsValid());
+    EXPECT_TRUE(handle == interner.Intern(second));
+    EXPECT_TRUE(handle != interner.Intern("World"));
+    EXPECT_NE(handle.View().Characters(), first.Characters());
+    EXPECT_STREQ(handle.View().Characters(), "Hello");
+    EXPECT_EQ(interner.Size(), 2);
+}
+
+TEST(DynstrInternerTest, FindsWithoutInterning)
+{
+    DynamicStringInterner interner(16);
+    DynamicStringInterner::Handle handle = interner.Intern("key");
+
+    EXPECT_TRUE(interner.Find("key") == handle);
+    EXPECT_FALSE(interner.Find("other").IsValid());
+    EXPECT_EQ(interner.Size(), 1);
+}
+
+TEST(DynstrInternerTest, ReturnsInvalidHandle_WhenFull)
+{
+    DynamicStringInterner interner(1);
+    ASSERT_EQ(interner.Capacity(), 2);
+
+    EXPECT_TRUE(interner.Intern("a").IsValid());
+    EXPECT_TRUE(interner.Intern("b").IsValid());
+    EXPECT_FALSE(interner.Intern("c").IsValid());
+    EXPECT_TRUE(interner.Intern("a").IsValid());
+}
+
+TEST(DynstrInternerTest, KeepsArenasApart_WhileTablesComeAndGo)
+{
+    DynamicStringInterner lasting(16);
+    DynamicStringInterner::Handle kept = lasting.Intern("kept");
+
+    // the arenas of the destroyed tables are dropped from the cache of this thread
+    for (int i = 0; i < 10000; i++)
+    {
+        DynamicStringInterner temporary(4);
+        DynamicStringInterner::Handle handle = temporary.Intern("temporary");
+        ASSERT_STREQ(handle.View().Characters(), "temporary");
+        ASSERT_TRUE(lasting.Intern("kept") == kept);
+    }
+
+    EXPECT_EQ(lasting.Size(), 1);
+    EXPECT_STREQ(lasting.Intern("another").View().Characters(), "another");
+    EXPECT_EQ(lasting.Size(), 2);
+}
+
+TEST(DynstrInternerTest, InternsConcurrently)
+{
+    const int threadCount = 4;
+    const int stringCount = 1000;
+    DynamicStringInterner interner(stringCount);
+    std::vector<std::vector<DynamicStringInterner::Handle>> handles(threadCount);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++)
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < stringCount; i++)
+            {
+                DynamicStringBuilder builder;
+                builder.Append("string-").Append(i);
+                handles[t].push_back(interner.Intern(builder.Build()));
+            }
+        });
+    for (std::thread& thread : threads)
+        thread.join();
+
+    EXPECT_EQ(interner.Size(), stringCount);
+    for (int t = 1; t < threadCount; t++)
+        for (int i = 0; i < stringCount; i++)
+            ASSERT_TRUE(handles[t][i] == handles[0][i]);
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringMatcher.h"
+
+TEST(DynstrMatcherTest, FindsAllOverlappingMatches)
+{
+    std::vector<DynamicString> patterns = { "he", "she", "his", "hers" };
+    DynamicStringMatcher matcher(patterns);
+    DynamicString text = "ushers";
+
+    std::vector<DynamicStringMatcher::Match> matches = matcher.FindAll(text);
+
+    ASSERT_EQ(matches.size(), 3);
+    EXPECT_EQ(matches[0].pattern, 1); // "she" ends first and is the longest
+    EXPECT_EQ(matches[0].position, 1);
+    EXPECT_EQ(matches[1].pattern, 0);
+    EXPECT_EQ(matches[1].position, 2);
+    EXPECT_EQ(matches[2].pattern, 3);
+    EXPECT_EQ(matches[2].position, 2);
+}
+
+TEST(DynstrMatcherTest, FindsFirstMatch)
+{
+    std::vector<DynamicString> patterns = { "error", "warn", "fatal" };
+    DynamicStringMatcher matcher(patterns);
+
+    DynamicStringMatcher::Match match = matcher.FindFirst("[warn] then error");
+    EXPECT_EQ(match.pattern, 1);
+    EXPECT_EQ(match.position, 1);
+
+    match = matcher.FindFirst("all good");
+    EXPECT_EQ(match.position, DynamicString::NOT_FOUND);
+}
+
+TEST(DynstrMatcherTest, FindsCaseInsensitive)
+{
+    std::vector<DynamicString> patterns = { "Error", "DISK" };
+    DynamicStringMatcher matcher(patterns, true);
+
+    std::vector<DynamicStringMatcher::Match> matches = matcher.FindAll("ERROR: disk full");
+
+    ASSERT_EQ(matches.size(), 2);
+    EXPECT_EQ(matches[0].pattern, 0);
+    EXPECT_EQ(matches[1].pattern, 1);
+    EXPECT_EQ(matches[1].position, 7);
+    EXPECT_TRUE(DynamicStringMatcher(patterns).FindAll("ERROR: disk full").empty());
+}
+
+TEST(DynstrMatcherTest, CompressesTransitionsByByteClasses)
+{
+    std::vector<DynamicString> patterns = { "abc", "", "cab" };
+    DynamicStringMatcher matcher(patterns);
+
+    EXPECT_EQ(matcher.PatternCount(), 3);
+    EXPECT_EQ(matcher.StateCount(), 7);
+    EXPECT_TRUE(matcher.FindAll("xyz").empty());
+}
+
+TEST(DynstrMatcherTest, FindsInBatch_AcrossThreads)
+{
+    std::vector<DynamicString> patterns = { "GET", "POST" };
+    DynamicStringMatcher matcher(patterns);
+
+    std::vector<DynamicString> lines;
+    for (int i = 0; i < 100; i++)
+        lines.push_back(i % 2 ? "GET /index POST" : "HEAD /");
+
+    std::vector<std::vector<DynamicStringMatcher::Match>> results = matcher.FindAll(lines, 4);
+
+    ASSERT_EQ(results.size(), lines.size());
+    for (size_t i = 0; i < lines.size(); i++)
+    {
+        if (i % 2 == 0)
+        {
+            EXPECT_TRUE(results[i].empty());
+            continue;
+        }
+        ASSERT_EQ(results[i].size(), 2);
+        EXPECT_EQ(results[i][0].pattern, 0);
+        EXPECT_EQ(results[i][1].position, 11);
+    }
+}
@@ -151,4 +151,59 @@ TEST(DynstrMethodsTest, StringDoesntEqual)
 
     EXPECT_FALSE(string.Equals("!Hello"));
     EXPECT_FALSE(copy.Equals(string));
-}
\ No newline at end of file
+}
+
+TEST(DynstrMethodsTest, ReplacesAllCharacters)
+{
+    DynamicString string = "a-b-c";
+
+    EXPECT_EQ(string.ReplaceAll('-', '+'), 2);
+    EXPECT_STREQ(string.Characters(), "a+b+c");
+    EXPECT_EQ(string.ReplaceAll('x', 'y'), 0);
+}
+
+TEST(DynstrMethodsTest, ReplacesAll_InPlace_WhenNotLonger)
+{
+    DynamicString string = "a&amp;b&amp;&amp;";
+
+    EXPECT_EQ(string.ReplaceAll("&amp;", "&"), 3);
+    EXPECT_STREQ(string.Characters(), "a&b&&");
+    EXPECT_EQ(string.Length(), 5);
+    EXPECT_EQ(string.Capacity(), 17);
+
+    EXPECT_EQ(string.ReplaceAll("&", ""), 3);
+    EXPECT_STREQ(string.Characters(), "ab");
+}
+
+TEST(DynstrMethodsTest, ReplacesAll_SizingResultOnce_WhenLonger)
+{
+    DynamicString string = "<a><b>";
+
+    EXPECT_EQ(string.ReplaceAll("<", "&lt;"), 2);
+    EXPECT_STREQ(string.Characters(), "&lt;a>&lt;b>");
+    EXPECT_EQ(string.Length(), 12);
+    EXPECT_EQ(string.Capacity(), 12);
+}
+
+TEST(DynstrMethodsTest, ReplacesAll_NonOverlapping)
+{
+    DynamicString string = "aaaa";
+
+    EXPECT_EQ(string.ReplaceAll("aa", "b"), 2);
+    EXPECT_STREQ(string.Characters(), "bb");
+    EXPECT_EQ(string.ReplaceAll("", "x"), 0);
+    EXPECT_STREQ(string.Characters(), "bb");
+}
+
+
+TEST(DynstrMethodsTest, ComparesStrings)
+{
+    DynamicString string = "abc";
+
+    EXPECT_EQ(string.Compare("abc"), 0);
+    EXPECT_LT(string.Compare("abd"), 0);
+    EXPECT_LT(string.Compare("abcd"), 0);
+    EXPECT_GT(string.Compare("ab"), 0);
+    EXPECT_GT(string.Compare(""), 0);
+    EXPECT_LT(string.Compare("\xff"), 0);
+}
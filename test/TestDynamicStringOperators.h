@@ -1,6 +1,7 @@
 #pragma once
 
 #include <gtest/gtest.h>
+#include <set>
 
 #include "DynamicString.h"
 
@@ -99,4 +100,62 @@ TEST(DynstrOperatorsTest, PlusOperator_OnConstChar)
     EXPECT_STREQ(fruit2.Characters(), "banana");
     EXPECT_EQ(fruit2.Length(), 6);
     EXPECT_EQ(fruit2.Capacity(), 6);
-}
\ No newline at end of file
+}
+
+TEST(DynstrOperatorsTest, EqualityOperators_WithCStringsAndViews)
+{
+    DynamicString string = "Hello";
+    DynamicStringView view("Hello, World", 5);
+
+    EXPECT_TRUE(string == "Hello");
+    EXPECT_TRUE("Hello" == string);
+    EXPECT_TRUE(string == view);
+    EXPECT_TRUE(view == string);
+    EXPECT_TRUE(string != "Hell");
+    EXPECT_TRUE(string != "Hello!");
+    EXPECT_TRUE(string != DynamicString("Hello!"));
+
+    // the C-string is only read up to the first difference
+    const char* longer = "Hello and a long tail";
+    EXPECT_FALSE(string.Equals(longer));
+    EXPECT_TRUE(DynamicString().Equals(""));
+    EXPECT_TRUE(DynamicString().Equals(static_cast<const char*>(nullptr)));
+}
+
+TEST(DynstrOperatorsTest, OrderingOperators)
+{
+    DynamicString apple = "apple", banana = "banana", app = "app";
+
+    EXPECT_TRUE(apple < banana);
+    EXPECT_TRUE(app < apple);
+    EXPECT_TRUE(apple <= "apple");
+    EXPECT_TRUE("banana" > apple);
+    EXPECT_TRUE(banana >= DynamicStringView("b"));
+    EXPECT_FALSE(apple > banana);
+}
+
+#if __cplusplus >= 202002L
+TEST(DynstrOperatorsTest, ThreeWayComparisonOperator)
+{
+    DynamicString apple = "apple", banana = "banana", app = "app";
+
+    EXPECT_EQ(apple <=> banana, std::strong_ordering::less);
+    EXPECT_EQ(banana <=> apple, std::strong_ordering::greater);
+    EXPECT_EQ(apple <=> DynamicString("apple"), std::strong_ordering::equal);
+    EXPECT_EQ(app <=> apple, std::strong_ordering::less);
+    EXPECT_EQ(apple <=> DynamicStringView("apricot"), std::strong_ordering::less);
+    EXPECT_EQ(apple <=> "apple", std::strong_ordering::equal);
+    EXPECT_EQ(DynamicString("\xFF") <=> "a", std::strong_ordering::greater);
+}
+#endif
+
+TEST(DynstrOperatorsTest, OrdersStringsInStdSet)
+{
+    std::set<DynamicString> strings = { "pear", "apple", "fig", "apple" };
+
+    ASSERT_EQ(strings.size(), 3);
+    auto iterator = strings.begin();
+    EXPECT_STREQ((iterator++)->Characters(), "apple");
+    EXPECT_STREQ((iterator++)->Characters(), "fig");
+    EXPECT_STREQ((iterator++)->Characters(), "pear");
+}
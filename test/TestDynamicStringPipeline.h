@@ -0,0 +1,182 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringComparator.h"
+#include "DynamicStringPipeline.h"
+#include "DynamicStringQueue.h"
+#include "DynamicStringSorter.h"
+#include "DynamicStringWriter.h"
+
+TEST(DynstrQueueTest, PassesEveryValueOnce_BetweenManyThreads)
+{
+    DynamicStringQueue<size_t> queue(4);
+    const size_t perProducer = 10000;
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < 3; p++)
+        producers.emplace_back([&queue, p] {
+            for (size_t i = 0; i < perProducer; i++)
+                queue.Push(p * perProducer + i + 1);
+        });
+
+    std::vector<size_t> sums(2, 0);
+    std::vector<std::thread> consumers;
+    for (size_t c = 0; c < sums.size(); c++)
+        consumers.emplace_back([&queue, &sums, c] {
+            size_t value = 0;
+            while (queue.Pop(value))
+                sums[c] += value;
+        });
+
+    for (std::thread& producer : producers)
+        producer.join();
+    queue.Close();
+    for (std::thread& consumer : consumers)
+        consumer.join();
+
+    size_t total = 3 * perProducer;
+    EXPECT_EQ(sums[0] + sums[1], total * (total + 1) / 2);
+}
+
+TEST(DynstrQueueTest, WakesSleepingThreads_OnPushPopAndClose)
+{
+    DynamicStringQueue<size_t> queue(2);
+    std::vector<size_t> popped(3, 0);
+    std::vector<std::thread> consumers;
+    for (size_t c = 0; c < popped.size(); c++)
+        consumers.emplace_back([&queue, &popped, c] {
+            size_t value = 0;
+            while (queue.Pop(value))
+                popped[c] += value;
+        });
+
+    // the consumers are long asleep by the time the values come one by one
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    for (size_t i = 1; i <= 4; i++)
+    {
+        queue.Push(i);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    queue.Close();
+    for (std::thread& consumer : consumers)
+        consumer.join();
+    EXPECT_EQ(popped[0] + popped[1] + popped[2], 10);
+
+    // a producer sleeping on the full queue is woken by a pop
+    DynamicStringQueue<size_t> full(2);
+    EXPECT_TRUE(full.TryPush(1));
+    EXPECT_TRUE(full.TryPush(2));
+    EXPECT_FALSE(full.TryPush(3));
+    std::thread producer([&full] { full.Push(3); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    size_t value = 0;
+    EXPECT_TRUE(full.TryPop(value));
+    producer.join();
+    EXPECT_TRUE(full.TryPop(value));
+    EXPECT_TRUE(full.TryPop(value));
+    EXPECT_EQ(value, 3);
+}
+
+#ifdef DYNSTR_HAS_IOVEC
+static std::string SortSequentially(DynamicStringSorter::Options options, const std::vector<std::string>& lines)
+{
+    DynamicStringSorter sorter(options.fold
+        ? DynamicStringComparator::Lexicographical_Reversed
+        : DynamicStringComparator::Lexicographical_Reversed_CaseInsensitive, options);
+    for (const std::string& line : lines)
+        sorter.Add(DynamicString(line.c_str()));
+
+    std::ostringstream stream;
+    {
+        DynamicStringWriter writer(stream);
+        sorter.WriteTo(writer);
+    }
+    return stream.str();
+}
+
+static std::string SortPipelined(DynamicStringSorter::Options options, const std::string& input)
+{
+    FILE* file = tmpfile();
+    EXPECT_NE(file, nullptr);
+    fwrite(input.data(), 1, input.size(), file);
+    fflush(file);
+    rewind(file);
+
+    // small chunks make lines span chunks and be longer than them
+    DynamicStringPipeline pipeline(options.fold
+        ? DynamicStringComparator::Views::Lexicographical_Reversed
+        : DynamicStringComparator::Views::Lexicographical_Reversed_CaseInsensitive, options, 64);
+    EXPECT_TRUE(pipeline.ReadFrom(fileno(file)));
+    fclose(file);
+
+    std::ostringstream stream;
+    {
+        DynamicStringWriter writer(stream);
+        pipeline.WriteTo(writer);
+    }
+    return stream.str();
+}
+
+TEST(DynstrPipelineTest, SortsLikeSequentialSorter_InEveryMode)
+{
+    std::mt19937 random(7);
+    std::vector<std::string> lines;
+    std::string input;
+    for (int i = 0; i < 3000; i++)
+    {
+        std::string line(1 + random() % (i % 100 == 0 ? 150 : 6), 'a');
+        for (char& character : line)
+            character = static_cast<char>('a' + random() % 4);
+        lines.push_back(line);
+        input += line + "\n";
+    }
+
+    DynamicStringSorter::Options options;
+    options.threads = 3;
+    EXPECT_EQ(SortPipelined(options, input), SortSequentially(options, lines));
+
+    options.top = 10;
+    EXPECT_EQ(SortPipelined(options, input), SortSequentially(options, lines));
+
+    options.unique = true;
+    EXPECT_EQ(SortPipelined(options, input), SortSequentially(options, lines));
+
+    options.top = 0;
+    options.count = true;
+    EXPECT_EQ(SortPipelined(options, input), SortSequentially(options, lines));
+
+    // folded lines keep their case, and those equal but for case are ordered by their bytes
+    for (std::string& line : lines)
+        for (char& character : line)
+            if (random() % 2)
+                character = static_cast<char>(toupper(character));
+    input.clear();
+    for (const std::string& line : lines)
+        input += line + "\n";
+
+    options.fold = true;
+    EXPECT_EQ(SortPipelined(options, input), SortSequentially(options, lines));
+
+    options.unique = options.count = false;
+    EXPECT_EQ(SortPipelined(options, input), SortSequentially(options, lines));
+}
+
+TEST(DynstrPipelineTest, StopsAtEmptyLine_AndKeepsLastLineWithoutNewLine)
+{
+    DynamicStringSorter::Options options;
+    options.threads = 2;
+
+    EXPECT_EQ(SortPipelined(options, "b\nA\n\nc\n"), "b\nA\n");
+    EXPECT_EQ(SortPipelined(options, "b\nA\nc"), "c\nb\nA\n");
+    EXPECT_EQ(SortPipelined(options, ""), "");
+}
+#endif
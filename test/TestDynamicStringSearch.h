@@ -0,0 +1,76 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include "DynamicString.h"
+#include "DynamicStringSearcher.h"
+
+TEST(DynstrSearchTest, FindsShortPattern)
+{
+    DynamicString string = "the quick brown fox jumps over the lazy dog";
+
+    EXPECT_EQ(string.Find("the"), 0);
+    EXPECT_EQ(string.Find("the", 1), 31);
+    EXPECT_EQ(string.Find("dog"), 40);
+    EXPECT_EQ(string.Find("g"), 42);
+    EXPECT_EQ(string.Find("cat"), DynamicString::NOT_FOUND);
+    EXPECT_EQ(string.Find(""), 0);
+    EXPECT_EQ(string.Find("", 43), 43);
+    EXPECT_EQ(string.Find("the", 44), DynamicString::NOT_FOUND);
+}
+
+TEST(DynstrSearchTest, FindsShortPattern_AcrossBlocks)
+{
+    DynamicString string;
+    for (int i = 0; i < 100; i++)
+        string.Concatenate("ab");
+    string.Concatenate("abc");
+
+    EXPECT_EQ(string.Find("abc"), 200);
+    EXPECT_EQ(string.Find("bab", 150), 151);
+}
+
+TEST(DynstrSearchTest, FindsLongPattern)
+{
+    DynamicString pattern = "0123456789abcdefghijklmnopqrstuvwxyz";
+    DynamicString string;
+    for (int i = 0; i < 10; i++)
+        string.Concatenate("0123456789abcdefghijklmnopqrstuvwxy_");
+    string.Concatenate(pattern.Characters());
+
+    EXPECT_EQ(string.Find(pattern), 360);
+    EXPECT_EQ(string.Find(pattern, 361), DynamicString::NOT_FOUND);
+
+    // a long haystack is searched using a skip table even for a single search
+    DynamicString longString;
+    for (int i = 0; i < 100; i++)
+        longString.Concatenate("0123456789abcdefghijklmnopqrstuvwxy_");
+    longString.Concatenate(pattern.Characters());
+
+    EXPECT_EQ(longString.Find(pattern), 3600);
+    EXPECT_EQ(longString.Find(pattern, 10), 3600);
+    EXPECT_EQ(longString.Find(pattern, 3601), DynamicString::NOT_FOUND);
+    EXPECT_EQ(DynamicStringSearcher(pattern).Find(longString), 3600);
+}
+
+TEST(DynstrSearchTest, FindsCaseInsensitive)
+{
+    DynamicString string = "Error: Disk FULL on /dev/sda";
+
+    EXPECT_EQ(string.FindCaseInsensitive("full"), 12);
+    EXPECT_EQ(string.FindCaseInsensitive("ERROR"), 0);
+    EXPECT_EQ(string.FindCaseInsensitive("DEV/SDA"), 21);
+    EXPECT_EQ(string.FindCaseInsensitive("disks"), DynamicString::NOT_FOUND);
+    EXPECT_EQ(string.Find("full"), DynamicString::NOT_FOUND);
+}
+
+TEST(DynstrSearchTest, ReusesSearcher_AcrossStrings)
+{
+    DynamicStringSearcher searcher("key=42");
+    DynamicString lines[] = { "a=1 key=42", "key=4", "key=42;key=42" };
+
+    EXPECT_EQ(searcher.Find(lines[0]), 4);
+    EXPECT_EQ(searcher.Find(lines[1]), DynamicString::NOT_FOUND);
+    EXPECT_EQ(searcher.Find(lines[2]), 0);
+    EXPECT_EQ(searcher.Find(lines[2], 1), 7);
+}
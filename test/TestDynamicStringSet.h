@@ -0,0 +1,117 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringComparator.h"
+#include "DynamicStringSet.h"
+
+static std::vector<std::string> Collect(const DynamicStringSet::Range& range)
+{
+    std::vector<std::string> strings;
+    for (const DynamicString& string : range)
+        strings.push_back(string.Characters());
+    return strings;
+}
+
+TEST(DynstrSetTest, KeepsStringsOrdered_WithoutDuplicates)
+{
+    DynamicStringSet set;
+
+    EXPECT_TRUE(set.Insert("pear"));
+    EXPECT_TRUE(set.Insert("apple"));
+    EXPECT_TRUE(set.Insert("fig"));
+    EXPECT_FALSE(set.Insert("apple"));
+
+    EXPECT_EQ(set.Size(), 3);
+    EXPECT_EQ(Collect({ set.begin(), set.end() }), std::vector<std::string>({ "apple", "fig", "pear" }));
+    EXPECT_TRUE(set.Contains("fig"));
+    EXPECT_FALSE(set.Contains("plum"));
+}
+
+TEST(DynstrSetTest, OrdersByComparator)
+{
+    DynamicStringSet set(DynamicStringComparator::Lexicographical_Reversed_CaseInsensitive);
+    const char* strings[] = { "Unix", "WIN32", "Apple", "MAC", "google", "AWK", "apple" };
+    for (const char* string : strings)
+        set.Insert(string);
+
+    // "apple" is equivalent to "Apple" when the case is ignored
+    EXPECT_EQ(set.Size(), 6);
+    EXPECT_EQ(Collect({ set.begin(), set.end() }),
+        std::vector<std::string>({ "WIN32", "Unix", "MAC", "google", "AWK", "Apple" }));
+    EXPECT_STREQ(set.Find("APPLE")->Characters(), "Apple");
+}
+
+TEST(DynstrSetTest, FindsBoundsAndRanges)
+{
+    DynamicStringSet set;
+    for (int i = 0; i < 1000; i += 2)
+        set.Insert(DynamicString(std::to_string(1000 + i).c_str()));
+
+    EXPECT_STREQ(set.LowerBound("1100")->Characters(), "1100");
+    EXPECT_STREQ(set.LowerBound("1101")->Characters(), "1102");
+    EXPECT_STREQ(set.UpperBound("1100")->Characters(), "1102");
+    EXPECT_TRUE(set.LowerBound("2000") == set.end());
+
+    EXPECT_EQ(Collect(set.Between("1500", "1507")), std::vector<std::string>({ "1500", "1502", "1504", "1506" }));
+    EXPECT_TRUE(Collect(set.Between("1507", "1500")).empty());
+    EXPECT_EQ(Collect(set.WithPrefix("199")).size(), 5);
+    EXPECT_EQ(Collect(set.WithPrefix("12")).size(), 50);
+    EXPECT_TRUE(Collect(set.WithPrefix("3")).empty());
+}
+
+TEST(DynstrSetTest, FindsPrefix_ShorterAndLongerThanKeys)
+{
+    DynamicStringSet set;
+    const char* strings[] = { "a", "ab", "abc", "abd", "b", "\xC3\xA9t\xC3\xA9", "\xC3\xA9" };
+    for (const char* string : strings)
+        set.Insert(string);
+
+    EXPECT_EQ(Collect(set.WithPrefix("ab")), std::vector<std::string>({ "ab", "abc", "abd" }));
+    EXPECT_EQ(Collect(set.WithPrefix("abcd")), std::vector<std::string>());
+    EXPECT_EQ(Collect(set.WithPrefix("\xC3\xA9")), std::vector<std::string>({ "\xC3\xA9", "\xC3\xA9t\xC3\xA9" }));
+    EXPECT_EQ(Collect(set.WithPrefix("")).size(), set.Size());
+}
+
+TEST(DynstrSetTest, FindsPrefix_UnderReversedCaseInsensitiveOrder)
+{
+    DynamicStringSet set(DynamicStringComparator::Lexicographical_Reversed_CaseInsensitive);
+    const char* strings[] = { "ab", "Abc", "ABD", "a", "abcd", "b", "aa", "ac" };
+    for (const char* string : strings)
+        set.Insert(string);
+
+    EXPECT_EQ(Collect(set.WithPrefix("aB")), std::vector<std::string>({ "ab", "ABD", "Abc", "abcd" }));
+    EXPECT_EQ(Collect(set.WithPrefix("")).size(), set.Size());
+}
+
+TEST(DynstrSetTest, MatchesStdSet_UnderRandomInsertionsAndRemovals)
+{
+    DynamicStringSet set;
+    std::set<std::string> expected;
+    std::mt19937 random(42);
+
+    for (int i = 0; i < 20000; i++)
+    {
+        std::string key = std::to_string(random() % 3000);
+        if (random() % 3 == 0)
+            EXPECT_EQ(set.Remove(key.c_str()), expected.erase(key) == 1) << "Removing " << key;
+        else
+            EXPECT_EQ(set.Insert(key.c_str()), expected.insert(key).second) << "Inserting " << key;
+    }
+
+    ASSERT_EQ(set.Size(), expected.size());
+    EXPECT_EQ(Collect({ set.begin(), set.end() }), std::vector<std::string>(expected.begin(), expected.end()));
+
+    for (const std::string& key : std::vector<std::string>(expected.begin(), expected.end()))
+        EXPECT_TRUE(set.Remove(key.c_str()));
+    EXPECT_EQ(set.Size(), 0);
+    EXPECT_TRUE(set.begin() == set.end());
+
+    EXPECT_TRUE(set.Insert("again"));
+    EXPECT_EQ(Collect({ set.begin(), set.end() }), std::vector<std::string>({ "again" }));
+}
@@ -3,9 +3,12 @@
 #include <gtest/gtest.h>
 #include <vector>
 #include <array>
+#include <sstream>
+#include <string>
 
 #include "DynamicString.h"
 #include "DynamicStringComparator.h"
+#include "DynamicStringSorter.h"
 
 TEST(DynstrSortTest, SortsReverseLexigocraphically_CaseInsensitive)
 {
@@ -38,4 +41,180 @@ TEST(DynstrSortTest, SortsReverseLexigocraphically_CaseInsensitive)
 
     for (size_t i = 0; i < actual.size(); i++)
         EXPECT_EQ(expected[i], actual[i]) << "Arrays differ at index " << i;
-}
\ No newline at end of file
+}
+
+static std::string SortWith(DynamicStringSorter::Options options, std::vector<DynamicString> strings)
+{
+    DynamicStringSorter sorter(options.fold
+        ? DynamicStringComparator::Lexicographical_Reversed
+        : DynamicStringComparator::Lexicographical_Reversed_CaseInsensitive, options);
+    for (DynamicString& string : strings)
+        sorter.Add(std::move(string));
+
+    std::ostringstream stream;
+    {
+        DynamicStringWriter writer(stream);
+        sorter.WriteTo(writer);
+    }
+    return stream.str();
+}
+
+TEST(DynstrSortTest, SortsAllStrings_ByDefault)
+{
+    DynamicStringSorter::Options options;
+
+    EXPECT_EQ(SortWith(options, { "b", "A", "c", "a" }), "c\nb\nA\na\n");
+}
+
+TEST(DynstrSortTest, SortsBytesPastAscii_AsUnsignedValues)
+{
+    DynamicStringSorter::Options options;
+
+    // the bytes past ASCII are not folded and go before every ASCII character,
+    // while a prefix still goes first
+    EXPECT_EQ(SortWith(options, { "z", "\xC3\xA9t\xC3\xA9", "A", "\x7F", "\xE2\x82\xAC", "\xC3\xA9" }),
+        "\xE2\x82\xAC\n\xC3\xA9\n\xC3\xA9t\xC3\xA9\n\x7F\nz\nA\n");
+}
+
+TEST(DynstrSortTest, KeepsOnlyTopStrings_InBoundedHeap)
+{
+    DynamicStringSorter::Options options;
+    options.top = 2;
+
+    DynamicStringSorter sorter(
+        DynamicStringComparator::Lexicographical_Reversed_CaseInsensitive, options);
+    const char* strings[] = { "apple", "Unix", "MAC", "win32", "google", "AWK" };
+    for (const char* string : strings)
+    {
+        sorter.Add(string);
+        EXPECT_LE(sorter.Size(), 2);
+    }
+
+    std::ostringstream stream;
+    {
+        DynamicStringWriter writer(stream);
+        sorter.WriteTo(writer);
+    }
+    EXPECT_EQ(stream.str(), "win32\nUnix\n");
+}
+
+TEST(DynstrSortTest, WritesUniqueStrings)
+{
+    DynamicStringSorter::Options options;
+    options.unique = true;
+
+    EXPECT_EQ(SortWith(options, { "b", "a", "b", "c", "a", "b" }), "c\nb\na\n");
+}
+
+TEST(DynstrSortTest, CountsUniqueStrings)
+{
+    DynamicStringSorter::Options options;
+    options.count = true;
+    options.top = 2;
+
+    EXPECT_EQ(SortWith(options, { "b", "a", "b", "c", "a", "b" }),
+        "      1 c\n      3 b\n");
+}
+
+TEST(DynstrSortTest, SortsFoldedStrings_LikeCaseInsensitiveOrder)
+{
+    std::vector<DynamicString> folded = {
+        "unix", "win32", "apple", "mac", "microsoft", "google", "awk", "c++", "ma", "",
+        "\xC3\xA9t\xC3\xA9", "zoo", "\x7F",
+    };
+    std::vector<DynamicString> expected = folded;
+
+    std::sort(folded.begin(), folded.end(), DynamicStringComparator::Lexicographical_Reversed);
+    std::sort(expected.begin(), expected.end(),
+        DynamicStringComparator::Lexicographical_Reversed_CaseInsensitive);
+
+    EXPECT_EQ(folded, expected);
+}
+
+TEST(DynstrSortTest, FoldsStrings_WhenAdded)
+{
+    DynamicStringSorter::Options options;
+    options.fold = true;
+    options.count = true;
+
+    DynamicStringSorter sorter(DynamicStringComparator::Lexicographical_Reversed, options);
+    for (const char* string : { "Apple", "apple", "UNIX", "Mac", "APPLE" })
+        sorter.Add(string);
+
+    std::ostringstream stream;
+    {
+        DynamicStringWriter writer(stream);
+        sorter.WriteTo(writer);
+    }
+    EXPECT_EQ(stream.str(), "      1 UNIX\n      1 Mac\n      1 APPLE\n      1 Apple\n      1 apple\n");
+
+    // the strings equal but for case are kept, ordered by their bytes
+    options.count = false;
+    DynamicStringSorter kept(DynamicStringComparator::Lexicographical_Reversed, options);
+    for (const char* string : { "a", "B", "A", "b", "a" })
+        kept.Add(string);
+
+    std::ostringstream keptStream;
+    {
+        DynamicStringWriter writer(keptStream);
+        kept.WriteTo(writer);
+    }
+    EXPECT_EQ(keptStream.str(), "B\nb\nA\na\na\n");
+}
+
+TEST(DynstrSortTest, WritesSameOutput_WithAndWithoutFolding)
+{
+    // no two different strings are equal but for case, so their order is the same
+    std::vector<DynamicString> strings = {
+        "Unix", "win32", "APPLE", "mac", "Microsoft", "unix2", "Google", "awk", "C++", "Ma",
+        "\xC3\xA9t\xC3\xA9", "Zoo", "\x7F", "", "Unix", "APPLE", "\xC3\xA9t\xC3\xA9", "[bracket]", "_under",
+    };
+
+    DynamicStringSorter::Options options;
+    DynamicStringSorter::Options folded;
+    folded.fold = true;
+    EXPECT_EQ(SortWith(folded, strings), SortWith(options, strings));
+
+    options.top = folded.top = 5;
+    EXPECT_EQ(SortWith(folded, strings), SortWith(options, strings));
+
+    options.unique = folded.unique = true;
+    EXPECT_EQ(SortWith(folded, strings), SortWith(options, strings));
+
+    options.top = folded.top = 0;
+    options.count = folded.count = true;
+    EXPECT_EQ(SortWith(folded, strings), SortWith(options, strings));
+}
+
+TEST(DynstrSortTest, ParsesOptions)
+{
+    const char* valid[] = { "dynstr", "--top", "10", "--count", "--fold" };
+    DynamicStringSorter::Options options;
+
+    EXPECT_TRUE(DynamicStringSorter::ParseOptions(5, valid, options));
+    EXPECT_EQ(options.top, 10);
+    EXPECT_TRUE(options.count);
+    EXPECT_TRUE(options.fold);
+    EXPECT_FALSE(options.unique);
+
+    const char* invalid[] = { "dynstr", "--top", "ten" };
+    EXPECT_FALSE(DynamicStringSorter::ParseOptions(3, invalid, options));
+    EXPECT_FALSE(DynamicStringSorter::ParseOptions(2, invalid, options));
+
+    // negative and overflowing numbers are not wrapped around into huge ones
+    for (const char* number : { "-1", "+5", " 5", "18446744073709551616", "99999999999999999999999" })
+    {
+        const char* top[] = { "dynstr", "--top", number };
+        const char* threads[] = { "dynstr", "--threads", number };
+        EXPECT_FALSE(DynamicStringSorter::ParseOptions(3, top, options)) << number;
+        EXPECT_FALSE(DynamicStringSorter::ParseOptions(3, threads, options)) << number;
+    }
+
+    std::string maxThreads = std::to_string(DynamicStringSorter::MaxThreads());
+    std::string tooManyThreads = std::to_string(DynamicStringSorter::MaxThreads() + 1);
+    const char* most[] = { "dynstr", "--threads", maxThreads.c_str() };
+    const char* tooMany[] = { "dynstr", "--threads", tooManyThreads.c_str() };
+    EXPECT_TRUE(DynamicStringSorter::ParseOptions(3, most, options));
+    EXPECT_EQ(options.threads, DynamicStringSorter::MaxThreads());
+    EXPECT_FALSE(DynamicStringSorter::ParseOptions(3, tooMany, options));
+}
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#include "DynamicString.h"
+
+static std::vector<DynamicString> CollectFields(const DynamicStringSplitRange& range)
+{
+    std::vector<DynamicString> fields;
+    for (DynamicStringView field : range)
+        fields.push_back(DynamicString(field));
+    return fields;
+}
+
+TEST(DynstrSplitTest, SplitsByCharacter_KeepingEmptyFields)
+{
+    DynamicString string = "a,,bc,";
+    std::vector<DynamicString> fields = CollectFields(string.Split(','));
+
+    ASSERT_EQ(fields.size(), 4);
+    EXPECT_STREQ(fields[0].Characters(), "a");
+    EXPECT_STREQ(fields[1].Characters(), "");
+    EXPECT_STREQ(fields[2].Characters(), "bc");
+    EXPECT_STREQ(fields[3].Characters(), "");
+}
+
+TEST(DynstrSplitTest, SplitsEmptyString_IntoSingleEmptyField)
+{
+    DynamicString string;
+    std::vector<DynamicString> fields = CollectFields(string.Split(','));
+
+    ASSERT_EQ(fields.size(), 1);
+    EXPECT_STREQ(fields[0].Characters(), "");
+}
+
+TEST(DynstrSplitTest, SplitsBySequence)
+{
+    DynamicString string = "one::two:three::";
+    std::vector<DynamicString> fields = CollectFields(string.Split("::"));
+
+    ASSERT_EQ(fields.size(), 3);
+    EXPECT_STREQ(fields[0].Characters(), "one");
+    EXPECT_STREQ(fields[1].Characters(), "two:three");
+    EXPECT_STREQ(fields[2].Characters(), "");
+}
+
+TEST(DynstrSplitTest, SplitsByAnyOfCharacters)
+{
+    DynamicString string = "id\tname,age";
+    std::vector<DynamicString> fields = CollectFields(string.SplitAny(",\t"));
+
+    ASSERT_EQ(fields.size(), 3);
+    EXPECT_STREQ(fields[0].Characters(), "id");
+    EXPECT_STREQ(fields[1].Characters(), "name");
+    EXPECT_STREQ(fields[2].Characters(), "age");
+}
+
+TEST(DynstrSplitTest, SplitsByAnyOfCharacters_AcrossBlocks)
+{
+    // delimiters both within and past the number compared 16 characters at a time
+    const char* delimiterSets[] = { ";", ",;|", "0123456789abcdef", "0123456789abcdefg!" };
+    DynamicString string;
+    for (int i = 0; i < 300; i++)
+        string.Add(static_cast<char>(i % 7 == 0 ? "0f;g!,|"[i % 5] : 'x' + i % 3));
+
+    for (const char* delimiters : delimiterSets)
+    {
+        std::vector<DynamicString> expected(1);
+        for (char character : string)
+        {
+            if (strchr(delimiters, character))
+                expected.emplace_back();
+            else
+                expected.back().Add(character);
+        }
+
+        EXPECT_EQ(CollectFields(string.SplitAny(delimiters)), expected) << delimiters;
+    }
+}
+
+TEST(DynstrSplitTest, SplitsByLongSequence)
+{
+    DynamicString delimiter;
+    for (int i = 0; i < 40; i++)
+        delimiter.Add(static_cast<char>('a' + i % 26));
+
+    DynamicString string;
+    for (const char* field : { "first", "", "second", "third" })
+    {
+        string.Concatenate(field);
+        string.Concatenate(delimiter.Characters());
+    }
+    std::vector<DynamicString> fields = CollectFields(string.Split(DynamicStringView(delimiter)));
+
+    ASSERT_EQ(fields.size(), 5);
+    EXPECT_STREQ(fields[0].Characters(), "first");
+    EXPECT_STREQ(fields[1].Characters(), "");
+    EXPECT_STREQ(fields[2].Characters(), "second");
+    EXPECT_STREQ(fields[3].Characters(), "third");
+    EXPECT_STREQ(fields[4].Characters(), "");
+}
+
+TEST(DynstrSplitTest, CopiesTemporaryDelimiters)
+{
+    DynamicString string = "a<->b<->c";
+    std::string longDelimiter(40, '~');
+    DynamicString longString = DynamicString("a") + longDelimiter.c_str() + "b";
+
+    // the delimiters are destroyed before the fields are iterated
+    DynamicStringSplitRange bySequence = string.Split(DynamicString("<->"));
+    DynamicStringSplitRange byLongSequence = longString.Split(DynamicString(longDelimiter.c_str()));
+    DynamicStringSplitRange byAny = string.SplitAny(DynamicString("<>"));
+    DynamicStringSplitRange tokens = string.Tokenize(DynamicString("-<>"));
+
+    std::vector<DynamicString> fields = CollectFields(bySequence);
+    ASSERT_EQ(fields.size(), 3);
+    EXPECT_STREQ(fields[1].Characters(), "b");
+
+    fields = CollectFields(byLongSequence);
+    ASSERT_EQ(fields.size(), 2);
+    EXPECT_STREQ(fields[0].Characters(), "a");
+    EXPECT_STREQ(fields[1].Characters(), "b");
+
+    fields = CollectFields(byAny);
+    ASSERT_EQ(fields.size(), 5);
+    EXPECT_STREQ(fields[1].Characters(), "-");
+    EXPECT_STREQ(fields[4].Characters(), "c");
+
+    fields = CollectFields(tokens);
+    ASSERT_EQ(fields.size(), 3);
+    EXPECT_STREQ(fields[2].Characters(), "c");
+}
+
+TEST(DynstrSplitTest, Tokenizes_SkippingEmptyFields)
+{
+    DynamicString string = "  Hello,  World! ";
+    std::vector<DynamicString> tokens = CollectFields(string.Tokenize(" ,"));
+
+    ASSERT_EQ(tokens.size(), 2);
+    EXPECT_STREQ(tokens[0].Characters(), "Hello");
+    EXPECT_STREQ(tokens[1].Characters(), "World!");
+
+    DynamicString blank = " , ";
+    EXPECT_TRUE(CollectFields(blank.Tokenize(" ,")).empty());
+}
+
+TEST(DynstrSplitTest, FieldsViewOriginalCharacters)
+{
+    DynamicString string = "key=value";
+    DynamicStringSplitRange range = string.Split('=');
+    DynamicStringSplitRange::Iterator field = range.begin();
+
+    EXPECT_EQ(field->Characters(), string.Characters());
+    EXPECT_EQ(field->Length(), 3);
+    ++field;
+    EXPECT_EQ(field->Characters(), string.Characters() + 4);
+    EXPECT_TRUE(*field == "value");
+    ++field;
+    EXPECT_TRUE(field == range.end());
+}
+
+TEST(DynstrSplitTest, JoinsStrings_IntoSingleAllocation)
+{
+    std::vector<DynamicString> strings = { "a", "bc", "", "def" };
+    DynamicString joined = DynamicString::Join(strings, ", ");
+
+    EXPECT_STREQ(joined.Characters(), "a, bc, , def");
+    EXPECT_EQ(joined.Length(), 12);
+    EXPECT_EQ(joined.Capacity(), 12);
+}
+
+TEST(DynstrSplitTest, JoinsEmptyRange)
+{
+    std::vector<DynamicStringView> views;
+    DynamicString joined = DynamicString::Join(views, ",");
+
+    EXPECT_STREQ(joined.Characters(), "");
+    EXPECT_EQ(joined.Length(), 0);
+}
+
+TEST(DynstrSplitTest, JoinsSplitFields)
+{
+    DynamicString string = "a;b;c";
+    DynamicString joined = DynamicString::Join(string.Split(';'), "+");
+
+    EXPECT_STREQ(joined.Characters(), "a+b+c");
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <cctype>
+#include <string>
+
+#include "DynamicString.h"
+#include "DynamicStringTransform.h"
+
+/// @brief Returns every byte value a few times, so the kernels see
+/// all of them at every position of their blocks.
+static std::string AllBytes()
+{
+    std::string bytes;
+    for (int round = 0; round < 3; round++)
+        for (int value = 0; value < 256; value++)
+            bytes += static_cast<char>((value * 37 + round) % 256);
+    return bytes;
+}
+
+TEST(DynstrTransformTest, ConvertsCase_LikeStandardFunctions)
+{
+    std::string bytes = AllBytes();
+    // every length and alignment, so both the blocks and the remainders are converted
+    for (size_t offset = 0; offset < 40; offset += 7)
+        for (size_t length = 0; length + offset <= bytes.size(); length += 13)
+        {
+            std::string lower(length, '\0'), upper(length, '\0');
+            DynamicStringTransform::ToLower(bytes.data() + offset, length, &lower[0]);
+            DynamicStringTransform::ToUpper(bytes.data() + offset, length, &upper[0]);
+
+            for (size_t i = 0; i < length; i++)
+            {
+                unsigned char character = static_cast<unsigned char>(bytes[offset + i]);
+                ASSERT_EQ(static_cast<unsigned char>(lower[i]), std::tolower(character));
+                ASSERT_EQ(static_cast<unsigned char>(upper[i]), std::toupper(character));
+            }
+        }
+}
+
+TEST(DynstrTransformTest, ConvertsStrings_InPlace_AndCopying)
+{
+    DynamicString string = "Hello, World! The Quick Brown Fox Jumps Over The Lazy Dog \xC3\x84";
+
+    DynamicString lower = string.ToLowerCopy();
+    DynamicString upper = string.ToUpperCopy();
+
+    EXPECT_STREQ(lower.Characters(), "hello, world! the quick brown fox jumps over the lazy dog \xC3\x84");
+    EXPECT_STREQ(upper.Characters(), "HELLO, WORLD! THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG \xC3\x84");
+    EXPECT_EQ(lower.Length(), string.Length());
+
+    string.ToUpper();
+    EXPECT_EQ(string, upper);
+    string.ToLower();
+    EXPECT_EQ(string, lower);
+}
+
+TEST(DynstrTransformTest, TellsAsciiStrings)
+{
+    std::string ascii(100, 'a');
+    EXPECT_TRUE(DynamicString(ascii.c_str()).IsAscii());
+    EXPECT_TRUE(DynamicString().IsAscii());
+
+    for (size_t position : { 0, 15, 16, 31, 32, 50, 99 })
+    {
+        std::string text = ascii;
+        text[position] = '\x80';
+        EXPECT_FALSE(DynamicString(text.c_str()).IsAscii()) << "at " << position;
+    }
+}
+
+TEST(DynstrTransformTest, CountsWhitespace_LikeIsspace)
+{
+    std::string bytes = AllBytes();
+    for (size_t length = 0; length <= 70; length++)
+        for (int value = 0; value < 256; value++)
+        {
+            // whitespace around a single other character
+            std::string text(length, ' ');
+            for (size_t i = 0; i < length; i++)
+                text[i] = "\t\n\v\f\r "[i % 6];
+            size_t position = length / 3;
+            if (length > 0)
+                text[position] = static_cast<char>(value);
+
+            bool isSpace = length == 0 || std::isspace(value);
+            size_t leading = DynamicStringTransform::CountLeadingWhitespace(text.data(), length);
+            size_t trailing = DynamicStringTransform::CountTrailingWhitespace(text.data(), length);
+            ASSERT_EQ(leading, isSpace ? length : position);
+            ASSERT_EQ(trailing, isSpace ? length : length - position - 1);
+        }
+}
+
+TEST(DynstrTransformTest, TrimsStrings_KeepingCapacity)
+{
+    DynamicString string = " \t\n  padded words with inner  spaces \r\n  ";
+    size_t capacity = string.Capacity();
+
+    EXPECT_STREQ(string.TrimLeftCopy().Characters(), "padded words with inner  spaces \r\n  ");
+    EXPECT_STREQ(string.TrimRightCopy().Characters(), " \t\n  padded words with inner  spaces");
+    EXPECT_STREQ(string.TrimCopy().Characters(), "padded words with inner  spaces");
+
+    string.Trim();
+    EXPECT_STREQ(string.Characters(), "padded words with inner  spaces");
+    EXPECT_EQ(string.Length(), 31);
+    EXPECT_EQ(string.Capacity(), capacity);
+
+    DynamicString blank = "   \t\t   \n";
+    EXPECT_TRUE(blank.IsAllWhitespace());
+    blank.Trim();
+    EXPECT_STREQ(blank.Characters(), "");
+    EXPECT_TRUE(blank.IsAllWhitespace());
+    EXPECT_FALSE(string.IsAllWhitespace());
+}
+
+TEST(DynstrTransformTest, TrimsViews)
+{
+    DynamicStringView view = "  key = value  ";
+
+    EXPECT_EQ(view.Trim(), "key = value");
+    EXPECT_EQ(view.TrimLeft(), "key = value  ");
+    EXPECT_EQ(view.TrimRight(), "  key = value");
+    EXPECT_EQ(DynamicStringView("   ").Trim(), "");
+    EXPECT_EQ(DynamicStringView().Trim(), "");
+}
+
+TEST(DynstrTransformTest, TransformsMovedFromStrings)
+{
+    DynamicString string = "  Text  ";
+    DynamicString other = std::move(string);
+
+    string.ToLower();
+    string.Trim();
+    EXPECT_EQ(string.ToUpperCopy().Length(), 0);
+    EXPECT_TRUE(string.IsAscii());
+    EXPECT_TRUE(string.IsAllWhitespace());
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <sstream>
+
+#include "DynamicString.h"
+#include "DynamicStringWriter.h"
+
+TEST(DynstrWriterTest, GathersLines_IntoSingleWrite)
+{
+    std::ostringstream stream;
+    {
+        DynamicStringWriter writer(stream);
+        for (int i = 0; i < 100; i++)
+            writer.WriteLine("line");
+
+        EXPECT_EQ(writer.WriteCount(), 0);
+        EXPECT_TRUE(writer.Flush());
+        EXPECT_EQ(writer.WriteCount(), 1);
+    }
+
+    EXPECT_EQ(stream.str().size(), 500);
+    EXPECT_EQ(stream.str().substr(0, 10), "line\nline\n");
+}
+
+TEST(DynstrWriterTest, WritesLargePieces_TogetherWithBuffer)
+{
+    DynamicString large;
+    for (int i = 0; i < 10; i++)
+        large.Concatenate("0123456789");
+
+    std::ostringstream stream;
+    DynamicStringWriter writer(stream, 16);
+    writer.Write("ab").Write(large).Write('c');
+    
+    EXPECT_EQ(writer.WriteCount(), 1);
+    writer.Flush();
+    EXPECT_EQ(writer.WriteCount(), 2);
+    EXPECT_EQ(stream.str(), std::string("ab") + large.Characters() + "c");
+}
+
+TEST(DynstrWriterTest, WritesBuilderChunks)
+{
+    DynamicStringBuilder builder(8);
+    for (int i = 0; i < 20; i++)
+        builder.Append(i).Append(',');
+
+    std::ostringstream stream;
+    DynamicStringWriter writer(stream, 16);
+    writer.Write(builder).Flush();
+
+    EXPECT_EQ(stream.str(), builder.Build().Characters());
+}
+
+TEST(DynstrWriterTest, StreamsDynamicStringWithLength)
+{
+    std::ostringstream stream;
+    DynamicString string = "Hello";
+    DynamicString moved = std::move(string);
+
+    stream << moved << string;
+
+    EXPECT_EQ(stream.str(), "Hello");
+}
+
+#ifdef DYNSTR_HAS_IOVEC
+TEST(DynstrWriterTest, WritesToFileDescriptor)
+{
+    FILE* file = tmpfile();
+    ASSERT_NE(file, nullptr);
+    {
+        DynamicStringWriter writer(fileno(file), 8);
+        writer.WriteLine("first").WriteLine("second line").Write("third");
+    }
+
+    char contents[64] = { 0 };
+    rewind(file);
+    size_t size = fread(contents, 1, sizeof(contents) - 1, file);
+    fclose(file);
+
+    EXPECT_EQ(size, 23);
+    EXPECT_STREQ(contents, "first\nsecond line\nthird");
+}
+#endif
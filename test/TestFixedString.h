@@ -0,0 +1,104 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "DynamicString.h"
+#include "DynamicStringComparator.h"
+#include "FixedString.h"
+
+// the checks below are evaluated while compiling
+constexpr FixedString<3> GET("GET");
+constexpr auto POST = MakeFixedString("POST");
+constexpr auto ROUTE = GET + " /" + POST;
+
+static_assert(ROUTE.Length() == 9, "concatenated at compile time");
+static_assert(ROUTE == "GET /POST", "compared at compile time");
+static_assert(ROUTE[4] == '/', "indexed at compile time");
+static_assert(GET < POST && !(POST < GET), "ordered at compile time");
+static_assert(MakeFixedString("ab").Compare(MakeFixedString("abc")) < 0, "a prefix goes first");
+static_assert(MakeFixedString("").IsEmpty(), "empty at compile time");
+
+/// @brief Returns the index of the key in the table of key hashes or -1.
+template <size_t Count>
+static int Lookup(const uint64_t (&table)[Count], DynamicStringView key)
+{
+    uint64_t hash = key.Hash();
+    for (size_t i = 0; i < Count; i++)
+        if (table[i] == hash)
+            return static_cast<int>(i);
+    return -1;
+}
+
+TEST(DynstrFixedTest, ReadsLikeView)
+{
+    constexpr auto string = MakeFixedString("Hello, World!");
+
+    EXPECT_EQ(string.Length(), 13);
+    EXPECT_STREQ(string.Characters(), "Hello, World!");
+    EXPECT_EQ(std::string(string.begin(), string.end()), "Hello, World!");
+    EXPECT_TRUE(string.Equals(DynamicStringView("Hello, World!")));
+    EXPECT_FALSE(string.Equals(DynamicStringView("Hello")));
+    EXPECT_GT(string.Compare("Hello"), 0);
+    EXPECT_EQ(DynamicStringView(string).Substring(7, 5), "World");
+}
+
+TEST(DynstrFixedTest, HashesLikeView_AtCompileTime)
+{
+    // the hashes of the keys are computed while compiling
+    static constexpr uint64_t keywords[] = {
+        MakeFixedString("").Hash(),
+        MakeFixedString("if").Hash(),
+        MakeFixedString("template").Hash(),
+        MakeFixedString("constexpr").Hash(),
+        MakeFixedString("static_assert and a few more words").Hash(),
+    };
+
+    const char* keys[] = { "", "if", "template", "constexpr", "static_assert and a few more words" };
+    for (int i = 0; i < 5; i++)
+        EXPECT_EQ(Lookup(keywords, DynamicString(keys[i])), i) << keys[i];
+    EXPECT_EQ(Lookup(keywords, "else"), -1);
+}
+
+TEST(DynstrFixedTest, SortsWithComparators)
+{
+    constexpr auto put = MakeFixedString("PUT");
+    std::vector<DynamicStringView> strings = { GET, POST, ROUTE, put };
+
+    std::sort(strings.begin(), strings.end(),
+        DynamicStringComparator::Views::Lexicographical_Reversed_CaseInsensitive);
+
+    EXPECT_EQ(strings[0], "PUT");
+    EXPECT_EQ(strings[1], "POST");
+    EXPECT_EQ(strings[2], "GET");
+    EXPECT_EQ(strings[3], "GET /POST");
+}
+
+TEST(DynstrFixedTest, CreatesDynamicStrings_WithoutCountingCharacters)
+{
+    DynamicString literal = "Hello";
+    DynamicString fixed = ROUTE;
+    char buffer[32] = "buffered";
+    DynamicString buffered = buffer;
+    const char* pointer = "pointed";
+    DynamicString pointed = pointer;
+
+    EXPECT_EQ(literal.Length(), 5);
+    EXPECT_EQ(literal.Capacity(), 5);
+    EXPECT_EQ(fixed, "GET /POST");
+    EXPECT_EQ(buffered.Length(), 8);
+    EXPECT_EQ(pointed, "pointed");
+    EXPECT_EQ(DynamicString("").Capacity(), 1);
+
+    // the literal is not scanned for its null character, so the length is that of its type
+    DynamicString embedded = "ab\0cd";
+    EXPECT_EQ(embedded.Length(), 5);
+    EXPECT_EQ(embedded[3], 'c');
+
+    const char name[16] = "abc";
+    DynamicString named = static_cast<const char*>(name);
+    EXPECT_EQ(named.Length(), 3);
+    EXPECT_EQ(named, "abc");
+}
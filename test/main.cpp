@@ -4,8 +4,21 @@
 #include "TestDynamicStringMethods.h"
 #include "TestDynamicStringConcat.h"
 #include "TestDynamicStringOperators.h"
+#include "TestDynamicStringSplit.h"
+#include "TestDynamicStringSearch.h"
+#include "TestDynamicStringTransform.h"
+#include "TestDynamicStringMatcher.h"
+#include "TestDynamicStringBuilder.h"
+#include "TestDynamicStringInterner.h"
+#include "TestDynamicStringWriter.h"
+#include "TestDynamicStringSet.h"
+#include "TestDynamicStringFrontCodedList.h"
+#include "TestDynamicStringArchive.h"
+#include "TestDynamicStringAllocator.h"
+#include "TestFixedString.h"
 
 #include "TestDynamicStringSort.h"
+#include "TestDynamicStringPipeline.h"
 
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);